@@ -0,0 +1,26 @@
+/**
+ * @file ActuatorCommands.hpp
+ *
+ * @details Header file for the actuator commands shared by the controllers
+ *
+ * Last Edited
+ * 2026-10-17
+**/
+
+#pragma once
+
+#include "interface.hpp"
+
+/**
+* @name command_magnetorquer
+* @param torquer [Magnetorquer *], the magnetorquer to command
+* @param dipole [float], the dipole to command, in A*m^2
+* @param timer [ADCS_timer *], the timer to wait on if the magnetorquer is not ready
+*
+* @details Commands a magnetorquer. A magnetorquer that is not ready yet is waited for, and a
+* dipole past its limit is clamped, then the command is retried once. If the command is still
+* rejected, the magnetorquer keeps its previous dipole.
+*
+* @returns [bool], false if the command was rejected, so the controller can count it.
+**/
+bool command_magnetorquer(Magnetorquer *torquer, float dipole, ADCS_timer *timer);
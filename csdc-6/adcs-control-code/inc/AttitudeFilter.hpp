@@ -0,0 +1,193 @@
+/**
+ * @file AttitudeFilter.hpp
+ *
+ * @details Header file for the attitude determination filter
+ *
+ * Last Edited
+ * 2026-10-17
+**/
+
+#pragma once
+
+#include <Eigen/Dense>
+#include <Eigen/Geometry>
+
+/**
+ * @class AttitudeFilter
+ *
+ * @details Multiplicative extended Kalman filter estimating the attitude of the satellite and the
+ * bias of the gyroscope. The attitude is kept as a quaternion rotating the body frame into the
+ * reference frame, and the filter works on a small body frame rotation error instead, so the
+ * quaternion never has to be constrained. The error state is the rotation error followed by the
+ * bias error.
+ *
+ * The attitude is propagated with the gyroscope rates, and corrected with either a full attitude
+ * measurement or the direction of any known reference vector (sun, magnetic field) measured in
+ * the body frame. All matrices are fixed size, so nothing is allocated after construction.
+**/
+class AttitudeFilter {
+public:
+    /**
+    * @typedef covariance
+    *
+    * @details Covariance of the error state, rotation error (rad) then bias error (rad/s).
+   **/
+    typedef Eigen::Matrix<float, 6, 6> covariance;
+
+    /**
+    * @name initialize
+    * @param attitude [Eigen::Quaternionf], the initial attitude estimate
+    * @param rate [Eigen::Vector3f], the initial gyroscope rate
+    * @param attitude_sigma [float], standard deviation of the initial attitude error, in rad
+    * @param bias_sigma [float], standard deviation of the initial gyroscope bias, in rad/s
+    *
+    * @details Starts the filter from an attitude with no gyroscope bias.
+   **/
+    void initialize(const Eigen::Quaternionf &attitude, const Eigen::Vector3f &rate, float attitude_sigma, float bias_sigma);
+
+    /**
+    * @name set_process_noise
+    * @param rate_noise [float], gyroscope angle random walk, in rad/sqrt(s)
+    * @param bias_noise [float], gyroscope bias random walk, in rad/s/sqrt(s)
+    *
+    * @details Sets how much the estimate is expected to drift between measurements.
+   **/
+    void set_process_noise(float rate_noise, float bias_noise);
+
+    /**
+    * @name propagate
+    * @param rate [Eigen::Vector3f], the gyroscope rate measured at the end of the interval
+    * @param delta_t [float], the time since the last propagation, in s
+    *
+    * @details Propagates the estimate over an interval with the average of the bias corrected
+    * rates measured at each end of it.
+   **/
+    void propagate(const Eigen::Vector3f &rate, float delta_t);
+
+    /**
+    * @name update_attitude
+    * @param measured [Eigen::Quaternionf], a measurement of the full attitude
+    * @param sigma [float], standard deviation of the measurement about each axis, in rad
+    *
+    * @details Corrects the estimate with an attitude measurement.
+   **/
+    void update_attitude(const Eigen::Quaternionf &measured, float sigma);
+
+    /**
+    * @name update_vector
+    * @param measured [Eigen::Vector3f], the direction of the reference vector in the body frame
+    * @param reference [Eigen::Vector3f], the direction of the reference vector in the reference
+    * frame
+    * @param sigma [float], standard deviation of the measured direction, in rad
+    *
+    * @details Corrects the estimate with a measured direction. One direction only corrects the
+    * two axes perpendicular to it.
+   **/
+    void update_vector(const Eigen::Vector3f &measured, const Eigen::Vector3f &reference, float sigma);
+
+    /**
+    * @name get_attitude
+    * @returns [Eigen::Quaternionf], the attitude estimate.
+   **/
+    const Eigen::Quaternionf &get_attitude() const;
+
+    /**
+    * @name get_attitude_vector
+    * @returns [Eigen::Vector3f], the attitude estimate as a rotation vector, in the same form as
+    * the gyroscope position.
+   **/
+    Eigen::Vector3f get_attitude_vector() const;
+
+    /**
+    * @name get_rate
+    * @returns [Eigen::Vector3f], the last gyroscope rate, corrected by the bias estimate.
+   **/
+    Eigen::Vector3f get_rate() const;
+
+    /**
+    * @name get_bias
+    * @returns [Eigen::Vector3f], the gyroscope bias estimate.
+   **/
+    const Eigen::Vector3f &get_bias() const;
+
+    /**
+    * @name get_covariance
+    * @returns [covariance], the covariance of the error state.
+   **/
+    const covariance &get_covariance() const;
+
+    /**
+    * @name exp
+    * @param rotation [Eigen::Vector3f], a rotation vector
+    * @returns [Eigen::Quaternionf], the rotation as a quaternion.
+   **/
+    static Eigen::Quaternionf exp(const Eigen::Vector3f &rotation);
+
+    /**
+    * @name log
+    * @param attitude [Eigen::Quaternionf], a rotation
+    * @returns [Eigen::Vector3f], the rotation as a rotation vector, with an angle of at most pi.
+   **/
+    static Eigen::Vector3f log(const Eigen::Quaternionf &attitude);
+
+private:
+    /**
+    * @name correct
+    * @param H [Eigen::Matrix<float, 3, 6>], the measurement matrix
+    * @param residual [Eigen::Vector3f], the measurement minus its prediction
+    * @param variance [float], the variance of the measurement on each axis
+    *
+    * @details Applies a three axis measurement to the estimate, then moves the rotation error into
+    * the attitude.
+   **/
+    void correct(const Eigen::Matrix<float, 3, 6> &H, const Eigen::Vector3f &residual, float variance);
+
+    /**
+    * @name skew
+    * @param v [Eigen::Vector3f], a vector
+    * @returns [Eigen::Matrix3f], the matrix taking the cross product of v with a vector.
+   **/
+    static Eigen::Matrix3f skew(const Eigen::Vector3f &v);
+
+    /**
+    * @property attitude [Eigen::Quaternionf]
+    *
+    * @details The attitude estimate, rotating the body frame into the reference frame.
+   **/
+    Eigen::Quaternionf attitude = Eigen::Quaternionf::Identity();
+
+    /**
+    * @property bias [Eigen::Vector3f]
+    *
+    * @details The gyroscope bias estimate.
+   **/
+    Eigen::Vector3f bias = Eigen::Vector3f::Zero();
+
+    /**
+    * @property rate [Eigen::Vector3f]
+    *
+    * @details The last gyroscope rate measured, before the bias is removed.
+   **/
+    Eigen::Vector3f rate = Eigen::Vector3f::Zero();
+
+    /**
+    * @property P [covariance]
+    *
+    * @details The covariance of the error state.
+   **/
+    covariance P = covariance::Identity();
+
+    /**
+    * @property rate_noise [float]
+    *
+    * @details Gyroscope angle random walk, in rad/sqrt(s).
+   **/
+    float rate_noise = 0;
+
+    /**
+    * @property bias_noise [float]
+    *
+    * @details Gyroscope bias random walk, in rad/s/sqrt(s).
+   **/
+    float bias_noise = 0;
+};
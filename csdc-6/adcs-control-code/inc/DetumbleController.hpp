@@ -0,0 +1,240 @@
+/**
+ * @file DetumbleController.hpp
+ *
+ * @details Header file for the detumble mode controller
+ *
+ * Last Edited
+ * 2026-10-17
+**/
+
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+#include "interface.hpp"
+#include "ActuatorCommands.hpp"
+#include "Executive.hpp"
+#include "TorqueAllocator.hpp"
+
+class DetumbleController {
+public:
+    /**
+    * @class DetumbleController
+    * @param sensors [unordered_map<string, shared_ptr<Sensor>], pointers to the satellite sensors
+    * @param actuators [unordered_map<string, shared_ptr<Actuator>], pointers to the satellite actuators
+    *
+    * @details Constructor for the detumble mode controller class. Removes the rate of the
+    * satellite after deployment with the B-dot law, using the magnetometer and magnetorquers.
+    * The gyroscope is optional and only used to detect when the satellite is detumbled.
+   **/
+    DetumbleController(
+        std::unordered_map<std::string, std::shared_ptr<Sensor>> sensors,
+        std::unordered_map<std::string, std::shared_ptr<Actuator>> actuators,
+        ADCS_timer *timer
+    );
+
+    /**
+    * @name begin
+    * @param detumble_rate [float], the rate below which the satellite is detumbled, in rad/s
+    *
+    * @details Starts the command loop. The B-dot task is run by the executive at its period
+    * until the timer throws. Once the satellite is detumbled the dipoles are held at zero.
+   **/
+    void begin(float detumble_rate);
+
+    /**
+    * @name get_executive
+    * @returns [Executive], the executive running the tasks of the controller, used to report
+    * their run time statistics.
+   **/
+    const Executive &get_executive() const;
+
+    /**
+    * @name is_detumbled
+    * @returns [bool], true once the measured rate has fallen below the detumble rate.
+   **/
+    bool is_detumbled() const;
+
+    /**
+    * @name get_detumble_time
+    * @returns [timestamp], the time from the start of the controller until it was detumbled.
+    * Only valid once is_detumbled is true.
+   **/
+    timestamp get_detumble_time() const;
+
+    /**
+    * @name get_rejected_commands
+    * @returns [uint32_t], the number of magnetorquer commands that were rejected even after
+    * being retried, so the magnetorquer kept its previous dipole.
+   **/
+    uint32_t get_rejected_commands() const;
+
+private:
+    /**
+    * @property magnetometer [Magnetometer *]
+    *
+    * @details The magnetometer, the only sensor the B-dot law needs.
+   **/
+    Magnetometer *magnetometer = nullptr;
+
+    /**
+    * @property gyro [Gyroscope *]
+    *
+    * @details The gyroscope, if there is one. Without it the rate of the field direction is
+    * used to detect when the satellite is detumbled.
+   **/
+    Gyroscope *gyro = nullptr;
+
+    /**
+    * @property magnetorquers [vector<Magnetorquer *>]
+    *
+    * @details The magnetorquers among the actuators, in the order used by the allocator.
+   **/
+    std::vector<Magnetorquer *> magnetorquers;
+
+    /**
+    * @property allocator [TorqueAllocator]
+    *
+    * @details Splits the desired dipole into the dipole of each magnetorquer, within the
+    * limits of each one.
+   **/
+    TorqueAllocator allocator;
+
+    /**
+    * @property lower_dipoles [Eigen::VectorXf]
+    *
+    * @details The lowest dipole of each magnetorquer.
+   **/
+    Eigen::VectorXf lower_dipoles;
+
+    /**
+    * @property upper_dipoles [Eigen::VectorXf]
+    *
+    * @details The highest dipole of each magnetorquer.
+   **/
+    Eigen::VectorXf upper_dipoles;
+
+    /**
+    * @property dipoles [Eigen::VectorXf]
+    *
+    * @details The dipole each magnetorquer is commanded to. Kept between cycles so it does
+    * not need to be allocated every cycle.
+   **/
+    Eigen::VectorXf dipoles;
+
+    ADCS_timer *timer;
+
+    /**
+    * @property rejected_commands [uint32_t]
+    *
+    * @details The number of magnetorquer commands that were rejected even after being retried.
+   **/
+    uint32_t rejected_commands = 0;
+
+    /**
+    * @property executive [Executive]
+    *
+    * @details Runs the B-dot task at its period.
+   **/
+    Executive executive;
+
+    /**
+    * @property bdot_period [timestamp]
+    *
+    * @details The period of the B-dot task. Short enough that the field direction turns by
+    * well under a radian between samples at the rates the satellite is deployed with.
+   **/
+    static constexpr timestamp bdot_period = timestamp(100, 0);
+
+    /**
+    * @property bdot_budget [timestamp]
+    *
+    * @details The longest the B-dot task is expected to run for.
+   **/
+    static constexpr timestamp bdot_budget = timestamp(2, 0);
+
+    /**
+    * @property bdot_gain [float]
+    *
+    * @details Gain of the B-dot law, in kg*m^2/s. From Avanzini and Giulietti, the fastest
+    * decay is with 2 * n * (1 + sin(i)) * J_min, for the orbit rate n of a 93 minute orbit,
+    * the 51.6 degree inclination of the ISS orbit and the smallest principal moment of the
+    * satellite, 0.00535 kg*m^2.
+   **/
+    static constexpr float bdot_gain = 2.2e-5f;
+
+    /**
+    * @property detumble_rate [float]
+    *
+    * @details The rate below which the satellite is detumbled, in rad/s.
+   **/
+    float detumble_rate;
+
+    /**
+    * @property detumbled [bool]
+    *
+    * @details Whether the satellite has been detumbled. Latched, so noise near the detumble
+    * rate does not switch the magnetorquers back on.
+   **/
+    bool detumbled;
+
+    /**
+    * @property start [timestamp]
+    *
+    * @details The time of the first measurement.
+   **/
+    timestamp start;
+
+    /**
+    * @property detumble_time [timestamp]
+    *
+    * @details The time from the start until the satellite was detumbled.
+   **/
+    timestamp detumble_time;
+
+    /**
+    * @property prev_direction [Eigen::Vector3f]
+    *
+    * @details The direction of the field in the body frame at the last measurement.
+   **/
+    Eigen::Vector3f prev_direction;
+
+    /**
+    * @property prev_time [timestamp]
+    *
+    * @details The time of the last measurement.
+   **/
+    timestamp prev_time;
+
+    /**
+    * @name take_field_measurement
+    * @returns [measurement], the magnetic field in the body frame, in T.
+    *
+    * @details Sleeps until the magnetometer is ready, without relying on exceptions.
+   **/
+    measurement take_field_measurement();
+
+    /**
+    * @name take_rate_measurement
+    * @returns [float], the magnitude of the rate measured by the gyroscope, in rad/s.
+    *
+    * @details Sleeps until the gyroscope is ready, without relying on exceptions.
+   **/
+    float take_rate_measurement();
+
+    /**
+    * @name bdot_task
+    *
+    * @details Task of the executive. Commands a dipole opposing the rate of change of the
+    * field direction, which always removes energy from the rotation of the satellite.
+   **/
+    void bdot_task();
+
+    /**
+    * @name command_dipole
+    * @param dipole [Eigen::Vector3f], the desired dipole in the body frame, in A*m^2
+    *
+    * @details Allocates the dipole to the magnetorquers and commands each of them.
+   **/
+    void command_dipole(const Eigen::Vector3f &dipole);
+};
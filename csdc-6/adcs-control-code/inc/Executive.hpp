@@ -0,0 +1,155 @@
+/**
+ * @file Executive.hpp
+ *
+ * @details Header file for the cooperative rate-monotonic executive of the control code
+ *
+ * Last Edited
+ * 2026-10-17
+**/
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+#include "interface.hpp"
+
+/**
+ * @struct task_stats
+ *
+ * @details Run time statistics of one task of the executive.
+ *
+ * @param releases          number of times the task has run.
+ * @param overruns          number of runs that took longer than the budget of the task.
+ * @param deadline_misses   number of runs that finished after the next release of the task.
+ * @param skipped_releases  number of releases that were dropped because the task was a whole
+ *                          period or more behind.
+ * @param max_run_time      longest run of the task.
+ * @param total_run_time    sum of every run of the task.
+**/
+typedef struct
+{
+    uint32_t  releases;
+    uint32_t  overruns;
+    uint32_t  deadline_misses;
+    uint32_t  skipped_releases;
+    timestamp max_run_time;
+    timestamp total_run_time;
+} task_stats;
+
+/**
+ * @class Executive
+ *
+ * @details Runs periodic tasks on a single core, paced by the ADCS_timer. Each task declares a
+ * period and a budget. Tasks are never interrupted: whenever tasks are due, the one with the
+ * shortest period runs to completion first (rate-monotonic priority, ties go to the task added
+ * first), and when no task is due the executive sleeps until the next release.
+ *
+ * A task that runs longer than its budget counts as an overrun, and one that finishes after its
+ * next release counts as a deadline miss. Releases a task has fallen a whole period behind on are
+ * dropped rather than run back to back.
+**/
+class Executive {
+public:
+    /**
+    * @name Executive
+    * @param timer [ADCS_timer *], the timer used to pace the tasks
+    *
+    * @details Constructor for the executive. Tasks are added with add_task.
+   **/
+    Executive(ADCS_timer *timer);
+
+    /**
+    * @name add_task
+    * @param name [string], the name of the task, used when reporting statistics
+    * @param period [timestamp], the time between releases of the task
+    * @param budget [timestamp], the longest the task is expected to run for
+    * @param function [function<void()>], the task to run once per release
+    *
+    * @details Adds a periodic task. Must be called before run.
+    *
+    * @returns [size_t], the index of the task, used to get its statistics.
+   **/
+    size_t add_task(const std::string &name, timestamp period, timestamp budget, std::function<void()> function);
+
+    /**
+    * @name run
+    * @param first_release [timestamp], the time every task is first released
+    *
+    * @details Runs the tasks forever. Returns only through an exception thrown by a task or the
+    * timer.
+   **/
+    void run(timestamp first_release);
+
+    /**
+    * @name run_next
+    *
+    * @details Runs the highest priority task that is due, or sleeps until the next release if
+    * none is. One iteration of run.
+   **/
+    void run_next();
+
+    /**
+    * @name num_tasks
+    * @returns [size_t], the number of tasks added.
+   **/
+    size_t num_tasks() const;
+
+    /**
+    * @name get_task_name
+    * @param index [size_t], the index of the task, from add_task
+    * @returns [string], the name of the task.
+   **/
+    const std::string &get_task_name(size_t index) const;
+
+    /**
+    * @name get_stats
+    * @param index [size_t], the index of the task, from add_task
+    * @returns [task_stats], the run time statistics of the task so far.
+   **/
+    const task_stats &get_stats(size_t index) const;
+
+private:
+    /**
+    * @struct task
+    *
+    * @details A task and its schedule.
+   **/
+    typedef struct
+    {
+        std::string           name;
+        timestamp             period;
+        timestamp             budget;
+        std::function<void()> function;
+        timestamp             release;
+        task_stats            stats;
+    } task;
+
+    /**
+    * @property tasks [vector<task>]
+    *
+    * @details The tasks, sorted from the highest priority to the lowest.
+   **/
+    std::vector<task> tasks;
+
+    /**
+    * @property order [vector<size_t>]
+    *
+    * @details The position in tasks of each task, by the index returned from add_task.
+   **/
+    std::vector<size_t> order;
+
+    /**
+    * @property timer [ADCS_timer *]
+    *
+    * @details The timer used to pace the tasks.
+   **/
+    ADCS_timer *timer;
+
+    /**
+    * @property now [timestamp]
+    *
+    * @details The time last returned by the timer, so it is not read more than needed.
+   **/
+    timestamp now;
+};
@@ -11,8 +11,14 @@
 
 #pragma once
 
+#include <functional>
 #include <unordered_map>
+#include <vector>
 #include "interface.hpp"
+#include "ActuatorCommands.hpp"
+#include "AttitudeFilter.hpp"
+#include "Executive.hpp"
+#include "TorqueAllocator.hpp"
 
 class PointingModeController {
 public:
@@ -23,7 +29,9 @@ public:
     *
     * @details Constructor for the pointing mode controller class. Initializes the internal references
     * to the satellite sensors and actuators which will be used to request information from the sensors
-    * and send commands to the actuators.
+    * and send commands to the actuators. If there are magnetorquers and a magnetometer, they are
+    * used to dump the momentum of the reaction wheels. The periods of the tasks are taken from the
+    * polling times of the gyroscope and reaction wheels.
    **/
     PointingModeController(
         std::unordered_map<std::string, std::shared_ptr<Sensor>> sensors,
@@ -36,11 +44,46 @@ public:
     * @param desired_attitue [vector<float>], the desired angle to point at
     * @param ramp_time [timestamp], the time over which to ramp to the new desired attitude
     *
-    * @details Starts the command loop. Should call the update functions once per cycle to get
-    * updated sensor measurements and sent commands to actuators accordingly
+    * @details Starts the command loop. The attitude and reaction wheel tasks are run by the
+    * executive at their own periods, until the timer throws.
    **/
     void begin(Eigen::Vector3f desired_attitude, timestamp ramp_time);
 
+    /**
+    * @name get_executive
+    * @returns [Executive], the executive running the tasks of the controller, used to report
+    * their run time statistics.
+   **/
+    const Executive &get_executive() const;
+
+    /**
+    * @name get_rejected_commands
+    * @returns [uint32_t], the number of actuator commands that were rejected even after being
+    * retried, so the actuator kept its previous command.
+   **/
+    uint32_t get_rejected_commands() const;
+
+    /**
+    * @name set_reaction_wheels
+    * @param reaction_wheels [vector<Reaction_wheel *>], the reaction wheels to control
+    *
+    * @details Replaces the reaction wheels used by the controller, e.g. after a wheel has
+    * failed, and recomputes the torque allocation for them. The wheels from the actuators
+    * passed to the constructor are used until this is called.
+   **/
+    void set_reaction_wheels(const std::vector<Reaction_wheel *> &reaction_wheels);
+
+    /**
+    * @name set_field_reference
+    * @param field_reference [function<Eigen::Vector3f(timestamp)>], the earth's magnetic field in
+    * the reference frame at the position of the satellite at a time, e.g. from the IGRF
+    *
+    * @details Lets the estimation task correct the attitude with the direction of the field
+    * measured by the magnetometer. Until this is called, the magnetometer is only used to dump
+    * momentum.
+   **/
+    void set_field_reference(std::function<Eigen::Vector3f(timestamp)> field_reference);
+
 private:
     /**
     * @property sensors [unordered_map<string, shared_ptr<Sensor>>]
@@ -59,8 +102,8 @@ private:
     /**
     * @property gyro [Gyroscope *]
     *
-    * @details A pointer to the gyroscope as this is currently the only sensor
-    * for which measurements are actually used.
+    * @details A pointer to the gyroscope, which measures the rate and attitude the estimate is
+    * built from.
    **/
     Gyroscope *gyro;
 
@@ -86,32 +129,377 @@ private:
     Eigen::Vector3f prev_integral;
 
     /**
-    * @property A_gen_inv [Eigen::Matrix3Xf]
+    * @property reaction_wheels [vector<Reaction_wheel *>]
+    *
+    * @details The reaction wheels among the actuators, in the order used by the allocator.
+   **/
+    std::vector<Reaction_wheel *> reaction_wheels;
+
+    /**
+    * @property allocator [TorqueAllocator]
+    *
+    * @details Splits the desired torques, as calculated by the controller, into individual
+    * scalar torques that should be applied by each reaction wheel, within the limits of
+    * each wheel.
+   **/
+    TorqueAllocator allocator;
+
+    /**
+    * @property max_torques [Eigen::VectorXf]
+    *
+    * @details The largest torque each reaction wheel can apply, with a margin so the
+    * commanded acceleration is always within the wheel limits.
+   **/
+    Eigen::VectorXf max_torques;
+
+    /**
+    * @property max_momenta [Eigen::VectorXf]
+    *
+    * @details The largest angular momentum of each reaction wheel, from its maximum speed.
+   **/
+    Eigen::VectorXf max_momenta;
+
+    /**
+    * @property lower_torques [Eigen::VectorXf]
+    *
+    * @details The lowest torque each reaction wheel can apply this cycle.
+   **/
+    Eigen::VectorXf lower_torques;
+
+    /**
+    * @property upper_torques [Eigen::VectorXf]
+    *
+    * @details The highest torque each reaction wheel can apply this cycle.
+   **/
+    Eigen::VectorXf upper_torques;
+
+    /**
+    * @property torque_margin [float]
     *
-    * @details The matrix A stores the rotational axes of each reaction wheel, one
-    * wheel per column. A_gen_inv is the generalised inverse of the matrix A, which
-    * is used to split the desired torques, as calculated by the controller, into
-    * individual scalar torques that should be applied by each reaction wheel.
+    * @details The fraction of each wheel's limits the controller uses.
    **/
-    Eigen::Matrix3Xf A_gen_inv;
+    static constexpr float torque_margin = 0.99f;
+
+    /**
+    * @property rw_states [vector<actuator_state>]
+    *
+    * @details The state of each reaction wheel, read once per cycle.
+   **/
+    std::vector<actuator_state> rw_states;
+
+    /**
+    * @property rw_torques [Eigen::VectorXf]
+    *
+    * @details The torque each reaction wheel is commanded to apply. Kept between cycles
+    * so it does not need to be allocated every cycle.
+   **/
+    Eigen::VectorXf rw_torques;
 
     ADCS_timer *timer;
 
+    /**
+    * @property rejected_commands [uint32_t]
+    *
+    * @details The number of actuator commands that were rejected even after being retried.
+   **/
+    uint32_t rejected_commands = 0;
+
+    /**
+    * @property executive [Executive]
+    *
+    * @details Runs the attitude and reaction wheel tasks at their periods.
+   **/
+    Executive executive;
+
+    /**
+    * @property estimation_period [timestamp]
+    *
+    * @details The period of the estimation task, the polling time of the gyroscope, so every
+    * run has a new measurement.
+   **/
+    timestamp estimation_period;
+
+    /**
+    * @property estimation_budget [timestamp]
+    *
+    * @details The longest the estimation task is expected to run for.
+   **/
+    static constexpr timestamp estimation_budget = timestamp(2, 0);
+
+    /**
+    * @property attitude_period [timestamp]
+    *
+    * @details The period of the attitude task, the same as the estimation task so every run
+    * uses a new estimate.
+   **/
+    timestamp attitude_period;
+
+    /**
+    * @property attitude_budget [timestamp]
+    *
+    * @details The longest the attitude task is expected to run for.
+   **/
+    static constexpr timestamp attitude_budget = timestamp(2, 0);
+
+    /**
+    * @property wheel_period [timestamp]
+    *
+    * @details The period of the reaction wheel task, the longer of the estimation period and
+    * the polling time of the slowest wheel passed to the constructor, so every wheel is ready
+    * for each command. Each command is limited so no wheel passes its max speed within one
+    * period.
+   **/
+    timestamp wheel_period;
+
+    /**
+    * @property wheel_budget [timestamp]
+    *
+    * @details The longest the reaction wheel task is expected to run for.
+   **/
+    static constexpr timestamp wheel_budget = timestamp(2, 0);
+
+    /**
+    * @property magnetometer [Magnetometer *]
+    *
+    * @details The magnetometer, used to correct the attitude estimate if there is a field
+    * reference, and to dump momentum if there are magnetorquers.
+   **/
+    Magnetometer *magnetometer = nullptr;
+
+    /**
+    * @property field_reference [function<Eigen::Vector3f(timestamp)>]
+    *
+    * @details The earth's magnetic field in the reference frame at a time, empty if there is
+    * none.
+   **/
+    std::function<Eigen::Vector3f(timestamp)> field_reference;
+
+    /**
+    * @property field_measurement [measurement]
+    *
+    * @details The latest magnetometer measurement, read by the estimation task and shared with
+    * the momentum dumping task.
+   **/
+    measurement field_measurement;
+
+    /**
+    * @property field_measured [bool]
+    *
+    * @details Whether the magnetometer has been read yet.
+   **/
+    bool field_measured = false;
+
+    /**
+    * @property magnetorquers [vector<Magnetorquer *>]
+    *
+    * @details The magnetorquers among the actuators, in the order used by the dipole allocator.
+   **/
+    std::vector<Magnetorquer *> magnetorquers;
+
+    /**
+    * @property dipole_allocator [TorqueAllocator]
+    *
+    * @details Splits the desired dipole into the dipole of each magnetorquer.
+   **/
+    TorqueAllocator dipole_allocator;
+
+    /**
+    * @property lower_dipoles [Eigen::VectorXf]
+    *
+    * @details The lowest dipole of each magnetorquer.
+   **/
+    Eigen::VectorXf lower_dipoles;
+
+    /**
+    * @property upper_dipoles [Eigen::VectorXf]
+    *
+    * @details The highest dipole of each magnetorquer.
+   **/
+    Eigen::VectorXf upper_dipoles;
+
+    /**
+    * @property dipoles [Eigen::VectorXf]
+    *
+    * @details The dipole each magnetorquer is commanded to.
+   **/
+    Eigen::VectorXf dipoles;
+
+    /**
+    * @property momentum_period [timestamp]
+    *
+    * @details The period of the momentum dumping task. The momentum changes slowly, so it
+    * runs far less often than the attitude loop.
+   **/
+    static constexpr timestamp momentum_period = timestamp(100, 0);
+
+    /**
+    * @property momentum_budget [timestamp]
+    *
+    * @details The longest the momentum dumping task is expected to run for.
+   **/
+    static constexpr timestamp momentum_budget = timestamp(2, 0);
+
+    /**
+    * @property dump_gain [float]
+    *
+    * @details Gain of the momentum dumping law, in 1/s. The wheel momentum across the field
+    * decays with a time constant of about 1 / dump_gain, slow enough that the attitude loop
+    * absorbs the magnetic torque.
+   **/
+    static constexpr float dump_gain = 0.005f;
+
+    /**
+    * @property filter [AttitudeFilter]
+    *
+    * @details Estimates the attitude from the gyroscope and, when there is a field reference,
+    * the magnetometer, rather than trusting any single measurement.
+   **/
+    AttitudeFilter filter;
+
+    /**
+    * @property estimate_time [timestamp]
+    *
+    * @details The time of the measurement of the latest attitude estimate.
+   **/
+    timestamp estimate_time;
+
+    /**
+    * @property attitude_sigma [float]
+    *
+    * @details Standard deviation of the attitude measured by the gyroscope, in rad.
+   **/
+    static constexpr float attitude_sigma = 1e-4f;
+
+    /**
+    * @property field_sigma [float]
+    *
+    * @details Standard deviation of the direction of the field measured by the magnetometer, in
+    * rad. Covers the magnetometer noise and the error of the field reference.
+   **/
+    static constexpr float field_sigma = 1e-2f;
+
+    /**
+    * @property initial_bias_sigma [float]
+    *
+    * @details Standard deviation of the gyroscope bias when the controller starts, in rad/s.
+   **/
+    static constexpr float initial_bias_sigma = 1e-3f;
+
+    /**
+    * @property gyro_rate_noise [float]
+    *
+    * @details Gyroscope angle random walk, in rad/sqrt(s).
+   **/
+    static constexpr float gyro_rate_noise = 1e-4f;
+
+    /**
+    * @property gyro_bias_noise [float]
+    *
+    * @details Gyroscope bias random walk, in rad/s/sqrt(s).
+   **/
+    static constexpr float gyro_bias_noise = 1e-6f;
+
+    /**
+    * @property desired_attitude [Eigen::Vector3f]
+    *
+    * @details The attitude to point at once the ramp is over.
+   **/
+    Eigen::Vector3f desired_attitude;
+
+    /**
+    * @property initial_attitude [Eigen::Vector3f]
+    *
+    * @details The attitude when the controller started, where the ramp starts from.
+   **/
+    Eigen::Vector3f initial_attitude;
+
+    /**
+    * @property ramp_time [timestamp]
+    *
+    * @details The time over which to ramp to the desired attitude.
+   **/
+    timestamp ramp_time;
+
+    /**
+    * @property start [timestamp]
+    *
+    * @details The time of the first measurement.
+   **/
+    timestamp start;
+
+    /**
+    * @property prev_time [timestamp]
+    *
+    * @details The time of the last measurement.
+   **/
+    timestamp prev_time;
+
+    /**
+    * @property desired_torque [Eigen::Vector3f]
+    *
+    * @details The body torque calculated by the last run of the attitude task, applied by the
+    * reaction wheel task.
+   **/
+    Eigen::Vector3f desired_torque;
+
     /**
     * @name take_updated_measurements
-    * @returns [measurement]
+    * @returns [gyro_state]
     *
-    * @details For now just checks the gyroscope to get an updated current attitude
-    * of the satellite.
+    * @details For now just checks the gyroscope to get an updated attitude and rate
+    * of the satellite. Sleeps until the gyroscope is ready, without relying on exceptions.
    **/
-    measurement take_updated_measurements();
+    gyro_state take_updated_measurements();
 
     /**
     * @name update
     *
     * @details One cycle of the PID controller iteration. Recalculates the desired torque
-    * based on the current attitude of the satellite and updates the accelerations of the 
-    * reaction wheels.
+    * based on the current attitude of the satellite.
    **/
     void update(Eigen::Vector3f current_attitude, Eigen::Vector3f desired_attitude, timestamp delta_t);
+
+    /**
+    * @name estimation_task
+    *
+    * @details Task of the executive. Propagates the attitude estimate with the measured rate
+    * and corrects it with the measured attitude, then with the direction of the magnetic field
+    * whenever the magnetometer has a new measurement.
+   **/
+    void estimation_task();
+
+    /**
+    * @name attitude_task
+    *
+    * @details Task of the executive. Runs the PID controller on the latest attitude estimate.
+   **/
+    void attitude_task();
+
+    /**
+    * @name wheel_task
+    *
+    * @details Task of the executive. Allocates the desired torque to the reaction wheels and
+    * updates their accelerations.
+   **/
+    void wheel_task();
+
+    /**
+    * @name command_wheel
+    * @param rw [Reaction_wheel *], the wheel to command
+    * @param target [actuator_state], the state to command the wheel to
+    *
+    * @details Commands a reaction wheel. A wheel that is not ready yet is waited for, and a
+    * state outside the wheel limits is clamped to them, then the command is retried once. A
+    * command that is still rejected is counted, and the wheel keeps its previous command.
+   **/
+    void command_wheel(Reaction_wheel *rw, actuator_state target);
+
+    /**
+    * @name momentum_task
+    *
+    * @details Task of the executive. Commands a dipole whose torque opposes the momentum of the
+    * reaction wheels, so the attitude loop moves it out of the wheels. Only the part of the
+    * momentum across the field can be removed at any time.
+   **/
+    void momentum_task();
 };
@@ -0,0 +1,223 @@
+/**
+ * @file SunSensorCalibration.hpp
+ *
+ * @details Calibration of the two dimensional sun sensor, from the bench calibration of the
+ * archived sun sensor code (archive/sun-sensors/two-dimension/calibrated_data.h). The sensor is
+ * a ring of four photodiodes in one plane, each facing 90 degrees clockwise of the one before it.
+ *
+ * Last Edited
+ * 2026-10-17
+**/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace sun_sensor_calibration {
+
+/**
+* @property num_diodes [size_t]
+*
+* @details The number of photodiodes in the sensor.
+**/
+constexpr size_t num_diodes = 4;
+
+/**
+* @property num_points [size_t]
+*
+* @details The number of calibration points of each diode.
+**/
+constexpr size_t num_points = 88;
+
+/**
+* @property max_voltage [float]
+*
+* @details The voltage of a diode facing the sun directly, in V.
+**/
+constexpr float max_voltage = 4.0f;
+
+/**
+* @property voltage [array<array<float>>]
+*
+* @details The voltage of each calibration point of each diode, as a fraction of the largest
+* voltage of the diode. Increasing, from the lowest voltage above the noise floor to 1.
+**/
+constexpr std::array<std::array<float, num_points>, num_diodes> voltage = {{
+    {{
+        0.13000000f, 0.14000000f, 0.15000000f, 0.16000000f, 0.17000000f, 0.18000000f, 0.19000000f, 0.20000000f,
+        0.21000000f, 0.22000000f, 0.23000000f, 0.24000000f, 0.25000000f, 0.26000000f, 0.27000000f, 0.28000000f,
+        0.29000000f, 0.30000000f, 0.31000000f, 0.32000000f, 0.33000000f, 0.34000000f, 0.35000000f, 0.36000000f,
+        0.37000000f, 0.38000000f, 0.39000000f, 0.40000000f, 0.41000000f, 0.42000000f, 0.43000000f, 0.44000000f,
+        0.45000000f, 0.46000000f, 0.47000000f, 0.48000000f, 0.49000000f, 0.50000000f, 0.51000000f, 0.52000000f,
+        0.53000000f, 0.54000000f, 0.55000000f, 0.56000000f, 0.57000000f, 0.58000000f, 0.59000000f, 0.60000000f,
+        0.61011905f, 0.62023810f, 0.62976190f, 0.63988095f, 0.65000000f, 0.66011905f, 0.67023810f, 0.67976190f,
+        0.68988095f, 0.70000000f, 0.71011905f, 0.72023810f, 0.72976190f, 0.73988095f, 0.75000000f, 0.76011905f,
+        0.77023810f, 0.77976190f, 0.78988095f, 0.80000000f, 0.81011905f, 0.82023810f, 0.82976190f, 0.83988095f,
+        0.85000000f, 0.86011905f, 0.87023810f, 0.87976190f, 0.88988095f, 0.90000000f, 0.91011905f, 0.92023810f,
+        0.92976190f, 0.93988095f, 0.95000000f, 0.96011905f, 0.97023810f, 0.97976190f, 0.98988095f, 1.00000000f
+    }},
+    {{
+        0.13000000f, 0.14000000f, 0.15000000f, 0.16000000f, 0.17000000f, 0.18000000f, 0.19000000f, 0.20000000f,
+        0.21000000f, 0.22000000f, 0.23000000f, 0.24000000f, 0.25000000f, 0.26000000f, 0.27000000f, 0.28000000f,
+        0.29000000f, 0.30000000f, 0.31000000f, 0.32000000f, 0.33000000f, 0.34000000f, 0.35000000f, 0.36000000f,
+        0.37000000f, 0.38000000f, 0.39000000f, 0.40000000f, 0.41000000f, 0.42000000f, 0.43000000f, 0.44000000f,
+        0.45000000f, 0.46000000f, 0.47000000f, 0.48000000f, 0.49000000f, 0.50000000f, 0.51000000f, 0.52000000f,
+        0.53000000f, 0.54000000f, 0.55000000f, 0.56000000f, 0.57000000f, 0.58000000f, 0.59000000f, 0.60000000f,
+        0.61024096f, 0.61987952f, 0.63012048f, 0.63975904f, 0.65000000f, 0.66024096f, 0.66987952f, 0.68012048f,
+        0.68975904f, 0.70000000f, 0.71024096f, 0.71987952f, 0.73012048f, 0.73975904f, 0.75000000f, 0.76024096f,
+        0.76987952f, 0.78012048f, 0.78975904f, 0.80000000f, 0.81024096f, 0.81987952f, 0.83012048f, 0.83975904f,
+        0.85000000f, 0.86024096f, 0.86987952f, 0.88012048f, 0.88975904f, 0.90000000f, 0.91024096f, 0.91987952f,
+        0.93012048f, 0.93975904f, 0.95000000f, 0.96024096f, 0.96987952f, 0.98012048f, 0.98975904f, 1.00000000f
+    }},
+    {{
+        0.13000000f, 0.14000000f, 0.15000000f, 0.16000000f, 0.17000000f, 0.18000000f, 0.19000000f, 0.20000000f,
+        0.21000000f, 0.22000000f, 0.23000000f, 0.24000000f, 0.25000000f, 0.26000000f, 0.27000000f, 0.28000000f,
+        0.29000000f, 0.30000000f, 0.31000000f, 0.32000000f, 0.33000000f, 0.34000000f, 0.35000000f, 0.36000000f,
+        0.37000000f, 0.38000000f, 0.39000000f, 0.40000000f, 0.41000000f, 0.42000000f, 0.43000000f, 0.44000000f,
+        0.45000000f, 0.46000000f, 0.47000000f, 0.48000000f, 0.49000000f, 0.50000000f, 0.51000000f, 0.52000000f,
+        0.53000000f, 0.54000000f, 0.55000000f, 0.56000000f, 0.57000000f, 0.58000000f, 0.59000000f, 0.60000000f,
+        0.61000000f, 0.62000000f, 0.62981366f, 0.63975155f, 0.65031056f, 0.66024845f, 0.67018634f, 0.68012422f,
+        0.69006211f, 0.70000000f, 0.70993789f, 0.71987578f, 0.72981366f, 0.73975155f, 0.75031056f, 0.76024845f,
+        0.77018634f, 0.78012422f, 0.79006211f, 0.80000000f, 0.80993789f, 0.81987578f, 0.82981366f, 0.83975155f,
+        0.85031056f, 0.86024845f, 0.87018634f, 0.88012422f, 0.89006211f, 0.90000000f, 0.90993789f, 0.91987578f,
+        0.92981366f, 0.93975155f, 0.95031056f, 0.96024845f, 0.97018634f, 0.98012422f, 0.99006211f, 1.00000000f
+    }},
+    {{
+        0.13000000f, 0.14000000f, 0.15000000f, 0.16000000f, 0.17000000f, 0.18000000f, 0.19000000f, 0.20000000f,
+        0.21000000f, 0.22000000f, 0.23000000f, 0.24000000f, 0.25000000f, 0.26000000f, 0.27000000f, 0.28000000f,
+        0.29000000f, 0.30000000f, 0.31000000f, 0.32000000f, 0.33000000f, 0.34000000f, 0.35000000f, 0.36000000f,
+        0.37000000f, 0.38000000f, 0.39000000f, 0.40000000f, 0.41000000f, 0.42000000f, 0.43000000f, 0.44000000f,
+        0.45000000f, 0.46000000f, 0.47000000f, 0.48000000f, 0.49000000f, 0.50000000f, 0.51000000f, 0.52000000f,
+        0.53000000f, 0.54000000f, 0.55000000f, 0.56000000f, 0.57000000f, 0.58000000f, 0.59000000f, 0.60000000f,
+        0.61005917f, 0.62011834f, 0.63017751f, 0.64023669f, 0.65029586f, 0.65976331f, 0.66982249f, 0.67988166f,
+        0.68994083f, 0.70000000f, 0.71005917f, 0.72011834f, 0.73017751f, 0.74023669f, 0.75029586f, 0.75976331f,
+        0.76982249f, 0.77988166f, 0.78994083f, 0.80000000f, 0.81005917f, 0.82011834f, 0.83017751f, 0.84023669f,
+        0.84970414f, 0.85976331f, 0.86982249f, 0.87988166f, 0.88994083f, 0.90000000f, 0.91005917f, 0.92011834f,
+        0.93017751f, 0.94023669f, 0.95029586f, 0.95976331f, 0.96982249f, 0.97988166f, 0.98994083f, 1.00000000f
+    }}
+}};
+
+/**
+* @property angle_top [array<array<float>>]
+*
+* @details The angle of the sun in the plane of the sensor at each calibration point, on the
+* side of the diode towards the diode before it, in degrees.
+**/
+constexpr std::array<std::array<float, num_points>, num_diodes> angle_top = {{
+    {{
+          80.5200f,   79.6700f,   78.8900f,   78.1700f,   77.4900f,   76.8400f,   76.2100f,   75.5900f,
+          74.9800f,   74.3700f,   73.7600f,   73.1500f,   72.5400f,   71.9200f,   71.3000f,   70.6700f,
+          70.0400f,   69.4100f,   68.7800f,   68.1400f,   67.5000f,   66.8600f,   66.2200f,   65.5700f,
+          64.9300f,   64.2800f,   63.6200f,   62.9700f,   62.3100f,   61.6400f,   60.9700f,   60.3000f,
+          59.6100f,   58.9200f,   58.2200f,   57.5100f,   56.7900f,   56.0600f,   55.3300f,   54.5800f,
+          53.8300f,   53.0700f,   52.3100f,   51.5400f,   50.7600f,   49.9800f,   49.2100f,   48.4300f,
+          47.6600f,   46.8900f,   46.1300f,   45.3700f,   44.6300f,   43.9000f,   43.1800f,   42.4800f,
+          41.7900f,   41.1200f,   40.4700f,   39.8300f,   39.2000f,   38.5900f,   37.9800f,   37.3900f,
+          36.7900f,   36.1900f,   35.5900f,   34.9700f,   34.3200f,   33.6500f,   32.9300f,   32.1600f,
+          31.3300f,   30.4300f,   29.4300f,   28.3400f,   27.1300f,   25.7800f,   24.3000f,   22.6500f,
+          20.8300f,   18.8200f,   16.6000f,   14.1800f,   11.5200f,    8.6350f,    5.5060f,    2.1320f
+    }},
+    {{
+          -8.4960f,   -9.3040f,  -10.0400f,  -10.7100f,  -11.3600f,  -11.9700f,  -12.5800f,  -13.1900f,
+         -13.7900f,  -14.4100f,  -15.0300f,  -15.6500f,  -16.2900f,  -16.9300f,  -17.5800f,  -18.2400f,
+         -18.8900f,  -19.5500f,  -20.2100f,  -20.8700f,  -21.5300f,  -22.1800f,  -22.8300f,  -23.4800f,
+         -24.1200f,  -24.7700f,  -25.4100f,  -26.0500f,  -26.6900f,  -27.3300f,  -27.9800f,  -28.6300f,
+         -29.2900f,  -29.9600f,  -30.6300f,  -31.3100f,  -32.0100f,  -32.7100f,  -33.4300f,  -34.1600f,
+         -34.9000f,  -35.6400f,  -36.4000f,  -37.1700f,  -37.9500f,  -38.7300f,  -39.5100f,  -40.2900f,
+         -41.0800f,  -41.8600f,  -42.6300f,  -43.3900f,  -44.1500f,  -44.8900f,  -45.6100f,  -46.3200f,
+         -47.0000f,  -47.6700f,  -48.3200f,  -48.9400f,  -49.5500f,  -50.1400f,  -50.7100f,  -51.2800f,
+         -51.8300f,  -52.3900f,  -52.9500f,  -53.5200f,  -54.1100f,  -54.7300f,  -55.4000f,  -56.1100f,
+         -56.8900f,  -57.7500f,  -58.7100f,  -59.7600f,  -60.9400f,  -62.2500f,  -63.7100f,  -65.3300f,
+         -67.1100f,  -69.0900f,  -71.2500f,  -73.6000f,  -76.1600f,  -78.9100f,  -81.8400f,  -84.9500f
+    }},
+    {{
+         -98.2400f,  -99.0500f,  -99.7700f, -100.4000f, -101.1000f, -101.7000f, -102.3000f, -102.8000f,
+        -103.4000f, -104.0000f, -104.6000f, -105.2000f, -105.9000f, -106.5000f, -107.1000f, -107.8000f,
+        -108.4000f, -109.1000f, -109.7000f, -110.3000f, -111.0000f, -111.6000f, -112.3000f, -112.9000f,
+        -113.6000f, -114.2000f, -114.8000f, -115.5000f, -116.1000f, -116.8000f, -117.4000f, -118.1000f,
+        -118.7000f, -119.4000f, -120.1000f, -120.7000f, -121.4000f, -122.1000f, -122.9000f, -123.6000f,
+        -124.3000f, -125.1000f, -125.8000f, -126.6000f, -127.4000f, -128.2000f, -128.9000f, -129.7000f,
+        -130.5000f, -131.3000f, -132.0000f, -132.8000f, -133.5000f, -134.3000f, -135.0000f, -135.7000f,
+        -136.4000f, -137.0000f, -137.7000f, -138.3000f, -138.9000f, -139.5000f, -140.1000f, -140.6000f,
+        -141.2000f, -141.8000f, -142.4000f, -143.0000f, -143.6000f, -144.3000f, -145.0000f, -145.7000f,
+        -146.6000f, -147.5000f, -148.5000f, -149.6000f, -150.8000f, -152.2000f, -153.7000f, -155.4000f,
+        -157.2000f, -159.2000f, -161.3000f, -163.7000f, -166.2000f, -168.8000f, -171.6000f, -174.4000f
+    }},
+    {{
+         170.6000f,  169.7000f,  169.0000f,  168.2000f,  167.6000f,  167.0000f,  166.3000f,  165.7000f,
+         165.2000f,  164.6000f,  164.0000f,  163.4000f,  162.8000f,  162.2000f,  161.5000f,  160.9000f,
+         160.3000f,  159.6000f,  159.0000f,  158.3000f,  157.7000f,  157.0000f,  156.4000f,  155.7000f,
+         155.1000f,  154.4000f,  153.7000f,  153.1000f,  152.4000f,  151.7000f,  151.1000f,  150.4000f,
+         149.7000f,  149.0000f,  148.3000f,  147.6000f,  146.9000f,  146.2000f,  145.5000f,  144.7000f,
+         144.0000f,  143.3000f,  142.5000f,  141.7000f,  141.0000f,  140.2000f,  139.5000f,  138.7000f,
+         137.9000f,  137.2000f,  136.4000f,  135.7000f,  134.9000f,  134.2000f,  133.5000f,  132.8000f,
+         132.1000f,  131.4000f,  130.7000f,  130.1000f,  129.5000f,  128.8000f,  128.2000f,  127.6000f,
+         127.0000f,  126.4000f,  125.8000f,  125.2000f,  124.5000f,  123.8000f,  123.1000f,  122.4000f,
+         121.6000f,  120.7000f,  119.7000f,  118.7000f,  117.5000f,  116.2000f,  114.7000f,  113.1000f,
+         111.3000f,  109.4000f,  107.2000f,  104.7000f,  102.0000f,   99.0900f,   95.8600f,   92.3400f
+    }}
+}};
+
+/**
+* @property angle_bot [array<array<float>>]
+*
+* @details The angle of the sun in the plane of the sensor at each calibration point, on the
+* side of the diode towards the diode after it, in degrees.
+**/
+constexpr std::array<std::array<float, num_points>, num_diodes> angle_bot = {{
+    {{
+         -85.9600f,  -85.1600f,  -84.3400f,  -83.5300f,  -82.7500f,  -81.9900f,  -81.2700f,  -80.5800f,
+         -79.9400f,  -79.3200f,  -78.7400f,  -78.1700f,  -77.6200f,  -77.0800f,  -76.5400f,  -75.9900f,
+         -75.4300f,  -74.8600f,  -74.2700f,  -73.6600f,  -73.0200f,  -72.3600f,  -71.6800f,  -70.9700f,
+         -70.2400f,  -69.5000f,  -68.7400f,  -67.9600f,  -67.1800f,  -66.4000f,  -65.6100f,  -64.8300f,
+         -64.0500f,  -63.2900f,  -62.5400f,  -61.8000f,  -61.0800f,  -60.3800f,  -59.7000f,  -59.0400f,
+         -58.3900f,  -57.7700f,  -57.1600f,  -56.5600f,  -55.9700f,  -55.3800f,  -54.8000f,  -54.2200f,
+         -53.6300f,  -53.0400f,  -52.4200f,  -51.8000f,  -51.1500f,  -50.4700f,  -49.7800f,  -49.0500f,
+         -48.3000f,  -47.5200f,  -46.7200f,  -45.8900f,  -45.0500f,  -44.1900f,  -43.3200f,  -42.4500f,
+         -41.5800f,  -40.7200f,  -39.8900f,  -39.0800f,  -38.3000f,  -37.5600f,  -36.8500f,  -36.2000f,
+         -35.5700f,  -34.9800f,  -34.4100f,  -33.8400f,  -33.2300f,  -32.5600f,  -31.7700f,  -30.8100f,
+         -29.5800f,  -28.0100f,  -25.9700f,  -23.3300f,  -19.9200f,  -15.5600f,  -10.0100f,   -3.0300f
+    }},
+    {{
+        -174.8000f, -173.9000f, -173.0000f, -172.2000f, -171.3000f, -170.6000f, -169.8000f, -169.1000f,
+        -168.5000f, -167.9000f, -167.3000f, -166.8000f, -166.3000f, -165.8000f, -165.3000f, -164.7000f,
+        -164.2000f, -163.6000f, -163.0000f, -162.4000f, -161.8000f, -161.1000f, -160.4000f, -159.6000f,
+        -158.9000f, -158.1000f, -157.3000f, -156.4000f, -155.6000f, -154.8000f, -153.9000f, -153.1000f,
+        -152.3000f, -151.5000f, -150.7000f, -149.9000f, -149.2000f, -148.5000f, -147.8000f, -147.2000f,
+        -146.5000f, -145.9000f, -145.4000f, -144.8000f, -144.3000f, -143.7000f, -143.2000f, -142.7000f,
+        -142.1000f, -141.6000f, -141.0000f, -140.5000f, -139.8000f, -139.2000f, -138.5000f, -137.8000f,
+        -137.1000f, -136.3000f, -135.5000f, -134.7000f, -133.8000f, -132.9000f, -132.0000f, -131.1000f,
+        -130.1000f, -129.2000f, -128.3000f, -127.5000f, -126.7000f, -125.9000f, -125.2000f, -124.6000f,
+        -124.0000f, -123.5000f, -123.0000f, -122.5000f, -122.0000f, -121.5000f, -120.9000f, -120.1000f,
+        -119.1000f, -117.7000f, -115.8000f, -113.3000f, -110.0000f, -105.6000f,  -99.8700f,  -92.5400f
+    }},
+    {{
+          95.2400f,   96.0900f,   96.9700f,   97.8400f,   98.6800f,   99.4800f,  100.2000f,  100.9000f,
+         101.6000f,  102.2000f,  102.8000f,  103.3000f,  103.8000f,  104.4000f,  104.9000f,  105.4000f,
+         105.9000f,  106.5000f,  107.0000f,  107.6000f,  108.3000f,  108.9000f,  109.6000f,  110.3000f,
+         111.1000f,  111.9000f,  112.7000f,  113.5000f,  114.3000f,  115.1000f,  116.0000f,  116.8000f,
+         117.6000f,  118.4000f,  119.2000f,  120.0000f,  120.7000f,  121.4000f,  122.1000f,  122.8000f,
+         123.4000f,  124.0000f,  124.6000f,  125.2000f,  125.7000f,  126.3000f,  126.8000f,  127.3000f,
+         127.9000f,  128.4000f,  129.0000f,  129.6000f,  130.2000f,  130.8000f,  131.4000f,  132.1000f,
+         132.9000f,  133.6000f,  134.4000f,  135.2000f,  136.1000f,  136.9000f,  137.8000f,  138.7000f,
+         139.6000f,  140.5000f,  141.4000f,  142.2000f,  143.0000f,  143.7000f,  144.4000f,  145.1000f,
+         145.7000f,  146.2000f,  146.8000f,  147.3000f,  147.8000f,  148.4000f,  149.1000f,  149.9000f,
+         151.1000f,  152.6000f,  154.6000f,  157.3000f,  160.8000f,  165.4000f,  171.4000f,  179.0000f
+    }},
+    {{
+           4.2840f,    5.0660f,    5.8540f,    6.6330f,    7.3880f,    8.1140f,    8.8080f,    9.4680f,
+          10.1000f,   10.7000f,   11.2800f,   11.8500f,   12.4100f,   12.9600f,   13.5200f,   14.0800f,
+          14.6600f,   15.2500f,   15.8600f,   16.4900f,   17.1400f,   17.8200f,   18.5200f,   19.2300f,
+          19.9700f,   20.7200f,   21.4800f,   22.2600f,   23.0400f,   23.8200f,   24.6000f,   25.3800f,
+          26.1500f,   26.9100f,   27.6500f,   28.3800f,   29.1000f,   29.8000f,   30.4800f,   31.1400f,
+          31.7900f,   32.4200f,   33.0300f,   33.6400f,   34.2300f,   34.8200f,   35.4100f,   36.0000f,
+          36.6000f,   37.2100f,   37.8200f,   38.4600f,   39.1100f,   39.7800f,   40.4800f,   41.2000f,
+          41.9400f,   42.7100f,   43.5000f,   44.3100f,   45.1300f,   45.9700f,   46.8100f,   47.6600f,
+          48.5000f,   49.3300f,   50.1400f,   50.9300f,   51.6900f,   52.4200f,   53.1100f,   53.7700f,
+          54.4000f,   55.0000f,   55.6000f,   56.2100f,   56.8500f,   57.5600f,   58.4000f,   59.4100f,
+          60.6800f,   62.2800f,   64.3300f,   66.9500f,   70.2900f,   74.5400f,   79.8900f,   86.5900f
+    }}
+}};
+
+} // namespace sun_sensor_calibration
@@ -0,0 +1,92 @@
+/**
+ * @file SunSensorDecoder.hpp
+ *
+ * @details Header file for the decoder of the two dimensional sun sensor
+ *
+ * Last Edited
+ * 2026-10-17
+**/
+
+#pragma once
+
+#include <Eigen/Dense>
+#include "SunSensorCalibration.hpp"
+
+/**
+ * @class SunSensorDecoder
+ *
+ * @details Finds the angle of the sun in the plane of a sun sensor from the voltages of its
+ * diodes. The sun lights at most two neighbouring diodes. The sunlight out of the plane of the
+ * sensor dims both by the same factor, so the angle is found from the difference of the two
+ * voltages over their sum, which does not depend on it.
+ *
+ * Within about 9 degrees of the peak of a diode its neighbours are below the calibration, and the
+ * voltage of the one lit diode can not tell which side of the peak the sun is on, or how much
+ * sunlight reaches the sensor. The peak is returned there, so the error is up to about 9 degrees
+ * in those bands and well under a degree everywhere else.
+ *
+ * The calibration curves are inverted at compile time into tables with evenly spaced voltages
+ * and voltage ratios, so each angle is found with one index and one interpolation instead of a
+ * search, and decoding does no allocation.
+**/
+class SunSensorDecoder {
+public:
+    /**
+    * @name SunSensorDecoder constructor
+    * @param axis [Eigen::Vector3f], the direction diode 0 faces in the body frame
+    * @param normal [Eigen::Vector3f], the normal of the plane of the sensor in the body frame.
+    * Angles are positive about it.
+    * @param max_voltage [float], the voltage of a diode facing the sun directly, in V
+   **/
+    SunSensorDecoder(Eigen::Vector3f axis, Eigen::Vector3f normal, float max_voltage = sun_sensor_calibration::max_voltage);
+
+    /**
+    * @name decode
+    * @param voltages [Eigen::Vector4f], the voltage of each diode, in V
+    * @param angle [float], set to the angle of the sun from the axis, in rad, if it is seen
+    *
+    * @returns [bool], false if no diode sees the sun, in which case angle is not changed.
+   **/
+    bool decode(const Eigen::Vector4f &voltages, float &angle) const;
+
+    /**
+    * @name sun_direction
+    * @param voltages [Eigen::Vector4f], the voltage of each diode, in V
+    * @param direction [Eigen::Vector3f], set to the unit vector towards the sun projected into
+    * the plane of the sensor, in the body frame, if it is seen
+    *
+    * @returns [bool], false if no diode sees the sun, in which case direction is not changed.
+   **/
+    bool sun_direction(const Eigen::Vector4f &voltages, Eigen::Vector3f &direction) const;
+
+    /**
+    * @property lut_size [size_t]
+    *
+    * @details The number of evenly spaced voltages in the table of each side of each diode, and
+    * of voltage ratios in the table of each pair of diodes. The calibration has about 88 points
+    * per diode, so this keeps all of its detail.
+   **/
+    static constexpr size_t lut_size = 128;
+
+private:
+    /**
+    * @property axis [Eigen::Vector3f]
+    *
+    * @details The direction diode 0 faces in the body frame, the direction of angle 0.
+   **/
+    Eigen::Vector3f axis;
+
+    /**
+    * @property perpendicular [Eigen::Vector3f]
+    *
+    * @details The direction of angle 90 degrees in the body frame.
+   **/
+    Eigen::Vector3f perpendicular;
+
+    /**
+    * @property voltage_scale [float]
+    *
+    * @details Converts a voltage to a fraction of the largest voltage of the diodes.
+   **/
+    float voltage_scale;
+};
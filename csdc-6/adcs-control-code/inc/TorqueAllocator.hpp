@@ -0,0 +1,115 @@
+/**
+ * @file TorqueAllocator.hpp
+ *
+ * @details Header file for the reaction wheel torque allocator
+ *
+ * Last Edited
+ * 2026-10-17
+**/
+
+#pragma once
+
+#include <vector>
+#include <Eigen/Dense>
+
+/**
+ * @class TorqueAllocator
+ *
+ * @details Splits a desired body torque into a torque for each reaction wheel, keeping each wheel
+ * within its own bounds. Uses the redistributed pseudoinverse: the minimum norm solution is found
+ * for the wheels that are not saturated, any wheel that exceeds its bounds is fixed at the bound,
+ * and the rest of the torque is redistributed over the remaining wheels. If the torque can not be
+ * reached at all, it is scaled down along its direction, so the satellite still turns the right
+ * way, as little as possible.
+ *
+ * Every call does a bounded amount of work, at most (1 + bisection_steps) redistributions of at
+ * most one pass per wheel each, and nothing is allocated after set_axes.
+**/
+class TorqueAllocator {
+public:
+    /**
+    * @name set_axes
+    * @param axes [Eigen::Matrix3Xf], the rotational axis of each reaction wheel, one wheel per column
+    *
+    * @details Sets the reaction wheels to allocate torque to, and precomputes the minimum norm
+    * allocation. Must be called again whenever the wheels change.
+    *
+    * @returns [bool], false if the axes do not span all three axes, in which case an arbitrary
+    * torque can not be allocated.
+   **/
+    bool set_axes(const Eigen::Matrix3Xf &axes);
+
+    /**
+    * @name allocate
+    * @param desired_torque [Eigen::Vector3f], the body torque to apply
+    * @param lower [Eigen::VectorXf], the lowest torque of each wheel, at most 0
+    * @param upper [Eigen::VectorXf], the highest torque of each wheel, at least 0
+    * @param torques [Eigen::VectorXf], set to the torque of each wheel. Must be sized to the number
+    * of wheels.
+    *
+    * @details Allocates the desired torque to the wheels within their bounds.
+    *
+    * @returns [float], the fraction of the desired torque that was allocated, 1 if all of it.
+   **/
+    float allocate(const Eigen::Vector3f &desired_torque, const Eigen::VectorXf &lower,
+                   const Eigen::VectorXf &upper, Eigen::VectorXf &torques);
+
+    /**
+    * @property bisection_steps [int]
+    *
+    * @details The number of steps used to search for the largest fraction of an unreachable torque
+    * that can be allocated. The fraction found is within 2^-bisection_steps of the best.
+   **/
+    static constexpr int bisection_steps = 8;
+
+private:
+    /**
+    * @name redistribute
+    * @param torque [Eigen::Vector3f], the body torque to apply
+    * @param lower [Eigen::VectorXf], the lowest torque of each wheel
+    * @param upper [Eigen::VectorXf], the highest torque of each wheel
+    * @param torques [Eigen::VectorXf], set to the torque of each wheel
+    *
+    * @details Runs the redistributed pseudoinverse.
+    *
+    * @returns [bool], true if the torque was allocated exactly within the bounds.
+   **/
+    bool redistribute(const Eigen::Vector3f &torque, const Eigen::VectorXf &lower,
+                      const Eigen::VectorXf &upper, Eigen::VectorXf &torques);
+
+    /**
+    * @property A [Eigen::Matrix3Xf]
+    *
+    * @details The rotational axis of each reaction wheel, one wheel per column.
+   **/
+    Eigen::Matrix3Xf A;
+
+    /**
+    * @property A_gen_inv [Eigen::MatrixX3f]
+    *
+    * @details The generalised inverse of A, the minimum norm allocation when no wheel saturates.
+   **/
+    Eigen::MatrixX3f A_gen_inv;
+
+    /**
+    * @property saturated [std::vector<bool>]
+    *
+    * @details Whether each wheel has been fixed at one of its bounds during a redistribution.
+   **/
+    std::vector<bool> saturated;
+
+    /**
+    * @property candidate [Eigen::VectorXf]
+    *
+    * @details The torques of a redistribution while searching for the largest fraction.
+   **/
+    Eigen::VectorXf candidate;
+
+    /**
+    * @property singular_threshold [float]
+    *
+    * @details The determinant below which the remaining free wheels are taken to not span all
+    * three axes.
+   **/
+    static constexpr float singular_threshold = 1e-6f;
+};
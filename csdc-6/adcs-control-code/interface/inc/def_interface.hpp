@@ -17,6 +17,7 @@
 #include <string>
 #include <Eigen/Dense>
 #include <iomanip>
+#include <sstream>
 
 #include "adcs_exception.hpp"
 
@@ -41,143 +42,140 @@
 #define INTERFACE SIM_INTERFACE
 
 /********************************************* TYPES *********************************************/
-/**
- * @exception invalid_ui_args
- *
- * @details exception used to indicate that a UI function has received bad arguments from the user.
-**/
-class timestamp_nullptr : public adcs_exception
-{
-    public:
-        timestamp_nullptr(const char* msg) : adcs_exception(msg) {}
-};
-
 /** ADCS specific timestamp definition. All time measurements use this structure.
+ *
+ * @details the time is stored as a single signed 64 bit count of microseconds, so all arithmetic
+ *          and comparisons are single integer operations. The range is roughly +/- 292 000 years,
+ *          and differences between timestamps may be negative.
  *
  * @param milliseconds  number of milliseconds of the timestamp
- * @param seconds       number of seconds of the timestamp. This is rolled-over from milliseconds.
+ * @param seconds       number of seconds of the timestamp. Added to the milliseconds.
  *
 **/
 class timestamp
 {
     public:
+        /* number of microseconds in a millisecond */
+        static constexpr int64_t microseconds_per_millisecond = 1000;
+
+        /* number of microseconds in a second */
+        static constexpr int64_t microseconds_per_second = 1000000;
+
+        /**
+         * @name timestamp constructor
+         *
+         * @details sets the time from a number of milliseconds and seconds.
+        **/
+        constexpr timestamp(uint32_t milliseconds = 0, uint32_t seconds = 0) :
+            ticks(milliseconds * microseconds_per_millisecond + seconds * microseconds_per_second) {}
+
         /**
          * @name timestamp constructor
          *
-         * @details sets initial values of millisecond and second fields.
+         * @details sets the time from a number of seconds, rounded to the nearest microsecond.
+         *          Values outside of the range of the timestamp saturate, NaN is treated as 0.
         **/
-        timestamp(uint32_t milliseconds = 0, uint32_t seconds = 0) : millisecond(milliseconds), second(seconds)
+        explicit constexpr timestamp(float real_person_time) : ticks(seconds_to_ticks(real_person_time)) {}
+
+        /**
+         * @name from_microseconds
+         *
+         * @details creates a timestamp from a raw number of microseconds.
+         *
+         * @returns the new timestamp
+        **/
+        static constexpr timestamp from_microseconds(int64_t microseconds)
         {
-            rebalance_timestamp(&this->millisecond, &this->second);
+            timestamp result;
+            result.ticks = microseconds;
+            return result;
         }
 
-        explicit timestamp(float real_person_time) : millisecond((float)(real_person_time - ((int)real_person_time)) * 1000.0), second(real_person_time){}; // check this conversion later its a bit hacky
+        /**
+         * @name microseconds
+         *
+         * @details raw tick accessor
+         *
+         * @returns the total number of microseconds of the timestamp
+        **/
+        constexpr int64_t microseconds() const {return this->ticks;}
+
         /**
          * @name milliseconds
          *
-         * @details millisecond field accessor
+         * @details millisecond accessor
          *
-         * @returns millisecond field
+         * @returns the total number of whole milliseconds of the timestamp
         **/
-        uint32_t milliseconds() {return this->millisecond;}
+        constexpr uint32_t milliseconds() const {return this->ticks / microseconds_per_millisecond;}
 
         /**
          * @name seconds
          *
-         * @details second field accessor
+         * @details second accessor
          *
-         * @returns second field
+         * @returns the total number of whole seconds of the timestamp
         **/
-        uint32_t seconds() {return this->second;}
+        constexpr uint32_t seconds() const {return this->ticks / microseconds_per_second;}
 
         /**
          * @name operator+ overload
          *
-         * @details adds two timestamps. Overflow of milliseconds increments seconds. Overflow of
-         *          seconds is explicitly allowed, the caller should deal with consequences of
-         *          second overflow.
+         * @details adds two timestamps.
          *
          * @returns result of addition.
         **/
-        timestamp operator+(const timestamp& b)
+        constexpr timestamp operator+(const timestamp& b) const
         {
-            timestamp result;
-
-            uint32_t l_millisecond = this->millisecond;
-            uint32_t r_millisecond = b.millisecond;
-            uint32_t l_second = this->second;
-            uint32_t r_second = b.second;
-
-            if (r_second > UINT32_MAX - l_second)
-            {
-                // explicitly allow overflow of the seconds field
-                result.second = (r_second > l_second) ? (r_second - l_second) : (l_second - r_second);
-            }
-            else
-            {
-                result.second = r_second + l_second;
-            }
-
-            uint32_t added_mil = 0;
-            uint32_t added_sec = 0;
-            add_milliseconds(l_millisecond, r_millisecond, &added_mil, &added_sec);
-
-            result.millisecond = added_mil;
-            result.second += added_sec;
-            return result;
+            return from_microseconds(this->ticks + b.ticks);
         }
 
         /**
          * @name operator- overload
          *
-         * @details subtracts two timestamps. Underflow is explicitly allowed, millisecond
-         *          underflow decrements the seconds field.
+         * @details subtracts two timestamps. The result is negative if b is larger.
          *
-         * @returns result of addition.
+         * @returns result of subtraction.
         **/
-        timestamp operator-(const timestamp& b)
+        constexpr timestamp operator-(const timestamp& b) const
         {
-            timestamp result;
-
-            if (b.second > this->second)
-            {
-                // explicitly allow underflow of the seconds field
-                result.second = UINT32_MAX - (b.second - this->second);
-            }
-            else
-            {
-                result.second = this->second - b.second;
-            }
-
-            if (b.millisecond > this->millisecond)
-            {
-                // underflow milliseconds and decrement seconds by 1. Again, allow seconds to underflow.
-                result.millisecond = UINT32_MAX - (b.millisecond - this->millisecond);
-                result.second = (0 == result.second) ? UINT32_MAX : result.second - 1;
-            }
-            else
-            {
-                result.millisecond = this->millisecond - b.millisecond;
-            }
-
-            rebalance_timestamp(&result.millisecond, &result.second);
-            return result;
+            return from_microseconds(this->ticks - b.ticks);
         }
 
-        explicit operator float() const { return this->millisecond / 1000.0 + (float) this->second; }
+        /**
+         * @name operator float
+         *
+         * @returns the timestamp in seconds.
+        **/
+        explicit constexpr operator float() const
+        {
+            return static_cast<float>(static_cast<double>(this->ticks) / microseconds_per_second);
+        }
 
         /**
-         * @name operator+ overload
+         * @name operator+= overload
          *
-         * @details adds two timestamps. Overflow of milliseconds increments seconds. Overflow of
-         *          seconds is explicitly allowed, the caller should deal with consequences of
-         *          second overflow.
+         * @details adds a timestamp to this one.
          *
          * @returns result of addition.
         **/
-        timestamp operator+=(const timestamp& b)
+        constexpr timestamp& operator+=(const timestamp& b)
+        {
+            this->ticks += b.ticks;
+            return *this;
+        }
+
+        /**
+         * @name operator-= overload
+         *
+         * @details subtracts a timestamp from this one.
+         *
+         * @returns result of subtraction.
+        **/
+        constexpr timestamp& operator-=(const timestamp& b)
         {
-            return *this + b;
+            this->ticks -= b.ticks;
+            return *this;
         }
 
         /**
@@ -185,22 +183,12 @@ class timestamp
          *
          * @details Compares two timestamps.
          *
-         * @returns true if the left side is smaller than the right side. If seconds are equal, it
-         *               checks milliseconds.
+         * @returns true if the left side is smaller than the right side.
          *          false if the left side is not smaller than the right.
         **/
-        friend bool operator<(const timestamp& l, const timestamp& r)
+        friend constexpr bool operator<(const timestamp& l, const timestamp& r)
         {
-            bool ret = false;
-            
-            if ( (l.second      < r.second)      ||
-               ( (l.millisecond < r.millisecond) &&
-                 (l.second      <= r.second)     ))
-            {
-                ret = true;
-            }
-
-            return ret;
+            return l.ticks < r.ticks;
         }
 
         /**
@@ -208,11 +196,10 @@ class timestamp
          *
          * @details compares two timestamps.
          *
-         * @returns true if the right side is smaller than the left side. If seconds are equal, it
-         *               checks milliseconds.
+         * @returns true if the right side is smaller than the left side.
          *          false if the right side is not smaller than the left.
         **/
-        friend bool operator>(const timestamp& l, const timestamp& r)
+        friend constexpr bool operator>(const timestamp& l, const timestamp& r)
         {
             return r < l;
         }
@@ -225,7 +212,7 @@ class timestamp
          * @returns true if the left side is smaller or equal to the right side. 
          *          false otherwise.
         **/
-        friend bool operator<=(const timestamp& l, const timestamp& r)
+        friend constexpr bool operator<=(const timestamp& l, const timestamp& r)
         {
             return !(l > r);
         }
@@ -238,7 +225,7 @@ class timestamp
          * @returns true if the right side is smaller or equal to the left side. 
          *          false otherwise.
         **/
-        friend bool operator>=(const timestamp& l, const timestamp& r)
+        friend constexpr bool operator>=(const timestamp& l, const timestamp& r)
         {
             return !(l < r);
         }
@@ -251,26 +238,20 @@ class timestamp
          * @returns true if the both sides are equal.
          *          false otherwise.
         **/
-        friend bool operator==(const timestamp& l, const timestamp& r)
+        friend constexpr bool operator==(const timestamp& l, const timestamp& r)
         {
-            bool ret = false;
-            if ((l.second      == r.second) &&
-                (l.millisecond == r.millisecond))
-            {
-                ret = true;
-            }
-            return ret;
+            return l.ticks == r.ticks;
         }
 
         /**
-         * @name operator== overload
+         * @name operator!= overload
          *
          * @details Compares two timestamps.
          *
          * @returns true if the both sides are not equal.
          *          false otherwise.
         **/
-        friend bool operator!=(const timestamp& l, const timestamp& r)
+        friend constexpr bool operator!=(const timestamp& l, const timestamp& r)
         {
             return !(l==r);
         }
@@ -283,15 +264,22 @@ class timestamp
          * @returns a string of the format:
          *          [mm:ss:msms]
         **/
-        std::string pretty_string()
+        std::string pretty_string() const
         {
-            uint32_t out_sec = (second + millisecond/1000);
-            uint32_t out_mil = millisecond % 1000;
-            uint32_t out_min = out_sec / 60;
+            int64_t total_ms = this->ticks / microseconds_per_millisecond;
+            bool negative = total_ms < 0;
+            if (negative)
+            {
+                total_ms = -total_ms;
+            }
+
+            int64_t out_mil = total_ms % 1000;
+            int64_t out_sec = total_ms / 1000;
+            int64_t out_min = out_sec / 60;
             out_sec %= 60;
 
             std::stringstream formatter;
-            formatter << "[" << out_min << ":" << std::setw(2) << std::setfill('0') << out_sec << ":";
+            formatter << "[" << (negative ? "-" : "") << out_min << ":" << std::setw(2) << std::setfill('0') << out_sec << ":";
             formatter << std::setw(4) << std::setfill('0') << out_mil << "]";
 
             return formatter.str();
@@ -299,101 +287,39 @@ class timestamp
 
     private:
         /**
-         * @name    rebalance_timestamp
+         * @name    seconds_to_ticks
          *
-         * @details given milliseconds and seconds fields, restructures the time so that the
-         *          maximum amount of time is in milliseconds as possible.
+         * @details converts a number of seconds to microseconds, rounding to the nearest
+         *          microsecond and saturating at the limits of the timestamp.
          *
-         * @param p_milliseconds the milliseconds field to rebalance.
-         * @param p_seconds      the seconds field to rebalance.
+         * @param seconds the number of seconds to convert.
+         *
+         * @returns the number of microseconds.
         **/
-        void rebalance_timestamp(uint32_t *p_milliseconds, uint32_t * p_seconds)
+        static constexpr int64_t seconds_to_ticks(float seconds)
         {
-            if ((nullptr == p_milliseconds) ||
-                (nullptr == p_seconds) )
-            {
-                throw timestamp_nullptr("Pointer in \"rebalance_timestamp\" is null.");
-            }
+            /* 2^62 microseconds, safely inside the range of int64_t and exactly representable */
+            constexpr double limit = 4611686018427387904.0;
+            double scaled = static_cast<double>(seconds) * microseconds_per_second;
 
-            uint32_t in_seconds      = *p_seconds;
-            uint32_t in_milliseconds = *p_milliseconds;
-
-            uint32_t out_seconds = 0;
-            uint32_t out_milliseconds = 0;
-
-            uint32_t seconds_to_milliseconds = 0;
-            uint32_t add_out_mil = 0;
-            uint32_t add_out_sec = 0;
-
-            // timestamps always use milliseconds first - if seconds is populated, try and move it to ms.
-            if ((UINT32_MAX / 1000) > in_seconds)
+            if (scaled != scaled)
             {
-                seconds_to_milliseconds = in_seconds * 1000;
-                add_milliseconds(seconds_to_milliseconds, in_milliseconds, &add_out_mil, &add_out_sec); 
+                return 0;
             }
-            else
+            else if (scaled >= limit)
             {
-                uint32_t saturation_milliseconds = UINT32_MAX - 1000;
-                out_seconds = in_seconds - saturation_milliseconds / 1000;
-                add_milliseconds(saturation_milliseconds, in_milliseconds, &add_out_mil, &add_out_sec);
+                return static_cast<int64_t>(limit);
             }
-
-            out_seconds += add_out_sec;
-            out_milliseconds = add_out_mil;
-
-            *p_seconds = out_seconds;
-            *p_milliseconds = out_milliseconds;
-        }
-
-        /**
-         * @name    add_milliseconds
-         *
-         * @details adds two millisecond fields such that overflow populates a seconds field. The
-         *          algorithm is such that milliseconds are always favoured, and seconds are only
-         *          populated once milliseconds are full. Upon overflow, the milliseconds field
-         *          will loose 1000 milliseconds and be converted to seconds.
-         *
-         * @param p_milliseconds the milliseconds field to rebalance.
-         * @param p_seconds      the seconds field to rebalance.
-        **/
-        void add_milliseconds(uint32_t a, uint32_t b, uint32_t *p_out_mil, uint32_t *p_out_sec)
-        {
-            if ((nullptr == p_out_mil) ||
-                (nullptr == p_out_sec) )
-            {
-                throw timestamp_nullptr("Pointer in \"add_milliseconds\" is null.");
-            }
-
-            uint32_t out_sec = 0;
-            uint32_t out_mil = 0;
-            uint32_t r_millisecond = b;
-            uint32_t l_millisecond = a;
-            // This might not have to be a while loop, but it works for now.
-            while (r_millisecond > UINT32_MAX - l_millisecond)
+            else if (scaled <= -limit)
             {
-                out_sec++;
-                if (r_millisecond > l_millisecond)
-                {
-                    r_millisecond -= 1000;
-                }
-                else
-                {
-                    l_millisecond -= 1000;
-                }
+                return -static_cast<int64_t>(limit);
             }
 
-            out_mil = r_millisecond + l_millisecond;
-
-            *p_out_mil = out_mil;
-            *p_out_sec = out_sec;
-            return;
+            return static_cast<int64_t>(scaled + ((scaled < 0) ? -0.5 : 0.5));
         }
 
-        /* the milliseconds of the timestamp. If overflowed, second is incremented. */
-        uint32_t millisecond;
-
-        /* seconds of the timestamp. */
-        uint32_t second;
+        /* number of microseconds of the timestamp. */
+        int64_t ticks;
 };
 
 /**
@@ -420,6 +346,21 @@ typedef struct
     timestamp       time_taken;
 } gyro_state;
 
+/**
+ * @struct  sun_sensor_state
+ *
+ * @details Return structure from sun sensors.
+ *
+ * @param voltage       voltage of each diode of the sensor, in V.
+ * @param time_taken    time the measurement was taken.
+ *
+**/
+typedef struct
+{
+    Eigen::Vector4f voltage;
+    timestamp       time_taken;
+} sun_sensor_state;
+
 /**
  * @struct  actuator_state
  * 
@@ -437,6 +378,54 @@ typedef struct {
     timestamp   time;
 } actuator_state;
 
+/**
+ * @enum    device_status
+ *
+ * @details outcome of a non-throwing device call.
+ *
+ * @param ok            the call succeeded, the value is valid.
+ * @param not_ready     the device has not completed its poll delay. Nothing was done.
+ * @param invalid_state the requested actuator state is outside the actuator limits. Nothing was
+ *                      done.
+**/
+enum class device_status
+{
+    ok,
+    not_ready,
+    invalid_state
+};
+
+/**
+ * @struct  device_result
+ *
+ * @details Return structure of the non-throwing device calls (try_take_measurement,
+ *          try_set_target_state). These never throw for a device that is not ready, so they can
+ *          be used in the control loop on targets without exceptions.
+ *
+ * @param status            outcome of the call.
+ * @param value             result of the call. Only valid if the status is ok.
+ * @param time_until_ready  if not ready, the time until the device can be polled again.
+ *                          Otherwise 0.
+ *
+**/
+template <typename T>
+struct device_result
+{
+    device_status   status;
+    T               value;
+    timestamp       time_until_ready;
+
+    /**
+     * @name operator bool
+     *
+     * @returns true if the call succeeded.
+    **/
+    explicit operator bool() const
+    {
+        return device_status::ok == status;
+    }
+};
+
 /******************************************* EXCEPTIONS ******************************************/
 /**
  * @exception device_not_ready
@@ -506,6 +495,13 @@ class ADCS_device {
         **/
         virtual timestamp time_until_ready();
 
+        /**
+         * @name    get_polling_time
+         *
+         * @returns the minimum amount of time between polling events for the device.
+        **/
+        virtual timestamp get_polling_time();
+
 };
 
 /**
@@ -531,6 +527,17 @@ class Sensor : public ADCS_device {
         **/
         virtual measurement take_measurement();
 
+        /**
+         * @name    try_take_measurement
+         *
+         * @details this function takes a measurement using the sensor if it is ready. Never
+         *          throws device_not_ready.
+         *
+         * @returns the measurement, or the time until the sensor is ready.
+         *
+        **/
+        virtual device_result<measurement> try_take_measurement();
+
         /**
          * @name    get_positions
          *
@@ -571,6 +578,19 @@ class Actuator : public ADCS_device {
         **/
         virtual void set_target_state(actuator_state target_state);
 
+        /**
+         * @name    try_set_target_state
+         *
+         * @details sets the target state if the actuator is ready and the state is valid. Never
+         *          throws device_not_ready or invalid_actuator_state.
+         *
+         * @param   target_state the new state the control code would like to be in.
+         *
+         * @returns the target state that was set, or why it was not.
+         *
+        **/
+        virtual device_result<actuator_state> try_set_target_state(actuator_state target_state);
+
         /**
          * @name    get_target_state
          *
@@ -637,6 +657,78 @@ class accelerometer : public Sensor
          * @returns the required measurement if succesful.
         **/
         measurement take_measurement();
+
+        /**
+         * @name    try_take_measurement
+         *
+         * @details this function takes a measurement using the sensor if it is ready. The
+         *          simulation is also told to update.
+         *
+         * @returns the measurement, or the time until the sensor is ready.
+        **/
+        device_result<measurement> try_take_measurement();
+};
+
+/**
+ * @class magnetometer
+ *
+ * @details concrete Sensor implementation for magnetometers
+ *
+ * @implements ADCS_device, Sensor
+**/
+class magnetometer : public Sensor
+{
+    public:
+        /**
+         * @name    take_measurement
+         *
+         * @details this function takes a measurement using the sensor. The simulation is also told
+         *          to update.
+         *
+         * @returns the required measurement if succesful.
+        **/
+        measurement take_measurement();
+
+        /**
+         * @name    try_take_measurement
+         *
+         * @details this function takes a measurement using the sensor if it is ready. The
+         *          simulation is also told to update.
+         *
+         * @returns the measurement, or the time until the sensor is ready.
+        **/
+        device_result<measurement> try_take_measurement();
+};
+
+/**
+ * @class sun_sensor
+ *
+ * @details concrete Sensor implementation for two dimensional sun sensors
+ *
+ * @implements ADCS_device, Sensor
+**/
+class sun_sensor : public Sensor
+{
+    public:
+        /**
+         * @name    take_measurement
+         *
+         * @details this function takes a measurement using the sensor. The simulation is also told
+         *          to update.
+         *
+         * @returns the voltage of each diode if succesful.
+        **/
+        sun_sensor_state take_measurement();
+
+        /**
+         * @name    try_take_measurement
+         *
+         * @details this function takes a measurement using the sensor if it is ready. The
+         *          simulation is also told to update.
+         *
+         * @returns the measurement, or the time until the sensor is ready.
+        **/
+        device_result<sun_sensor_state> try_take_measurement();
 };
 
 /**
@@ -658,6 +750,16 @@ class gyroscope : public Sensor
          * @returns the required measurement if succesful.
         **/
         measurement take_measurement();
+
+        /**
+         * @name    try_take_measurement
+         *
+         * @details this function takes a measurement using the sensor if it is ready. The
+         *          simulation is also told to update.
+         *
+         * @returns the measurement, or the time until the sensor is ready.
+        **/
+        device_result<measurement> try_take_measurement();
 };
 
 /**
@@ -693,6 +795,17 @@ class Reaction_wheel : public Actuator
         **/
         void set_target_state(actuator_state target_state);
 
+        /**
+         * @name    try_set_target_state
+         *
+         * @details sets the target state if the actuator is ready and the state is valid.
+         *
+         * @param   target_state the new state the control code would like to be in.
+         *
+         * @returns the target state that was set, or why it was not.
+        **/
+        device_result<actuator_state> try_set_target_state(actuator_state target_state);
+
         /**
          * @name    get_current_state
          *
@@ -703,4 +816,42 @@ class Reaction_wheel : public Actuator
         **/
         actuator_state get_current_state();
  };
+
+/**
+ * @class magnetorquer
+ *
+ * @details concrete Actuator implementation for magnetorquers
+ *
+ * @implements ADCS_device, Actuator
+**/
+class magnetorquer : public Actuator
+{
+    public:
+        /**
+         * @name    get_max_dipole
+         *
+         * @returns the largest dipole the magnetorquer can produce, in A*m^2.
+        **/
+        float get_max_dipole();
+
+        /**
+         * @name    set_dipole
+         *
+         * @details sets the magnetic dipole of the magnetorquer along its axis.
+         *
+         * @param   dipole the new dipole, in A*m^2.
+        **/
+        void set_dipole(float dipole);
+
+        /**
+         * @name    try_set_dipole
+         *
+         * @details sets the dipole if the actuator is ready and the dipole is valid.
+         *
+         * @param   dipole the new dipole, in A*m^2.
+         *
+         * @returns the dipole that was set, or why it was not.
+        **/
+        device_result<float> try_set_dipole(float dipole);
+};
 #endif
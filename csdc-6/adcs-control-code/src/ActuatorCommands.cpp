@@ -0,0 +1,29 @@
+/**
+ * @file ActuatorCommands.cpp
+ *
+ * @details Implementation for the actuator commands shared by the controllers
+ *
+ * Last Edited
+ * 2026-10-17
+**/
+
+#include <algorithm>
+
+#include "ActuatorCommands.hpp"
+
+bool command_magnetorquer(Magnetorquer *torquer, float dipole, ADCS_timer *timer) {
+    device_result<float> result = torquer->try_set_dipole(dipole);
+
+    if (device_status::not_ready == result.status) {
+        timer->sleep(result.time_until_ready);
+        result = torquer->try_set_dipole(dipole);
+    }
+
+    // The allocator keeps each dipole within its limit, so this only catches rounding
+    if (device_status::invalid_state == result.status) {
+        float max_dipole = torquer->get_max_dipole();
+        result = torquer->try_set_dipole(std::max(-max_dipole, std::min(dipole, max_dipole)));
+    }
+
+    return (bool) result;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file AttitudeFilter.cpp
+ *
+ * @details Implementation for the attitude determination filter
+ *
+ * Last Edited
+ * 2026-10-17
+**/
+
+#include "AttitudeFilter.hpp"
+
+void AttitudeFilter::initialize(const Eigen::Quaternionf &attitude, const Eigen::Vector3f &rate, float attitude_sigma, float bias_sigma) {
+    this->attitude = attitude.normalized();
+    this->bias = Eigen::Vector3f::Zero();
+    this->rate = rate;
+
+    this->P = covariance::Zero();
+    this->P.topLeftCorner<3, 3>().diagonal().setConstant(attitude_sigma * attitude_sigma);
+    this->P.bottomRightCorner<3, 3>().diagonal().setConstant(bias_sigma * bias_sigma);
+}
+
+void AttitudeFilter::set_process_noise(float rate_noise, float bias_noise) {
+    this->rate_noise = rate_noise;
+    this->bias_noise = bias_noise;
+}
+
+void AttitudeFilter::propagate(const Eigen::Vector3f &rate, float delta_t) {
+    const Eigen::Vector3f omega = 0.5f * (this->rate + rate) - this->bias;
+    this->rate = rate;
+
+    if (0 >= delta_t) {
+        return;
+    }
+
+    this->attitude = (this->attitude * exp(omega * delta_t)).normalized();
+
+    // The rotation error turns against the body rate and grows with the bias error
+    covariance Phi = covariance::Identity();
+    Phi.topLeftCorner<3, 3>() -= skew(omega) * delta_t;
+    Phi.topRightCorner<3, 3>() = -Eigen::Matrix3f::Identity() * delta_t;
+
+    this->P = Phi * this->P * Phi.transpose();
+    this->P.topLeftCorner<3, 3>().diagonal().array() += this->rate_noise * this->rate_noise * delta_t;
+    this->P.bottomRightCorner<3, 3>().diagonal().array() += this->bias_noise * this->bias_noise * delta_t;
+}
+
+void AttitudeFilter::update_attitude(const Eigen::Quaternionf &measured, float sigma) {
+    Eigen::Matrix<float, 3, 6> H = Eigen::Matrix<float, 3, 6>::Zero();
+    H.leftCols<3>().setIdentity();
+
+    const Eigen::Vector3f residual = log(this->attitude.conjugate() * measured);
+    this->correct(H, residual, sigma * sigma);
+}
+
+void AttitudeFilter::update_vector(const Eigen::Vector3f &measured, const Eigen::Vector3f &reference, float sigma) {
+    const Eigen::Vector3f predicted = this->attitude.conjugate() * reference.normalized();
+
+    Eigen::Matrix<float, 3, 6> H = Eigen::Matrix<float, 3, 6>::Zero();
+    H.leftCols<3>() = skew(predicted);
+
+    const Eigen::Vector3f residual = measured.normalized() - predicted;
+    this->correct(H, residual, sigma * sigma);
+}
+
+void AttitudeFilter::correct(const Eigen::Matrix<float, 3, 6> &H, const Eigen::Vector3f &residual, float variance) {
+    const Eigen::Matrix<float, 6, 3> P_H_t = this->P * H.transpose();
+    Eigen::Matrix3f S = H * P_H_t;
+    S.diagonal().array() += variance;
+
+    // S is symmetric positive definite, so the gain is solved for instead of inverting S
+    const Eigen::Matrix<float, 6, 3> K = S.llt().solve(P_H_t.transpose()).transpose();
+    const Eigen::Matrix<float, 6, 1> dx = K * residual;
+
+    this->attitude = (this->attitude * exp(dx.head<3>())).normalized();
+    this->bias += dx.tail<3>();
+
+    // Joseph form, so the covariance stays symmetric positive definite in single precision
+    const covariance I_KH = covariance::Identity() - K * H;
+    this->P = I_KH * this->P * I_KH.transpose() + variance * K * K.transpose();
+}
+
+const Eigen::Quaternionf &AttitudeFilter::get_attitude() const {
+    return this->attitude;
+}
+
+Eigen::Vector3f AttitudeFilter::get_attitude_vector() const {
+    return log(this->attitude);
+}
+
+Eigen::Vector3f AttitudeFilter::get_rate() const {
+    return this->rate - this->bias;
+}
+
+const Eigen::Vector3f &AttitudeFilter::get_bias() const {
+    return this->bias;
+}
+
+const AttitudeFilter::covariance &AttitudeFilter::get_covariance() const {
+    return this->P;
+}
+
+Eigen::Quaternionf AttitudeFilter::exp(const Eigen::Vector3f &rotation) {
+    const float angle = rotation.norm();
+    if (0 == angle) {
+        return Eigen::Quaternionf::Identity();
+    }
+
+    return Eigen::Quaternionf(Eigen::AngleAxisf(angle, rotation / angle));
+}
+
+Eigen::Vector3f AttitudeFilter::log(const Eigen::Quaternionf &attitude) {
+    Eigen::AngleAxisf rotation(attitude);
+
+    return rotation.angle() * rotation.axis();
+}
+
+Eigen::Matrix3f AttitudeFilter::skew(const Eigen::Vector3f &v) {
+    Eigen::Matrix3f m;
+    m <<     0, -v.z(),  v.y(),
+         v.z(),      0, -v.x(),
+        -v.y(),  v.x(),      0;
+    return m;
+}
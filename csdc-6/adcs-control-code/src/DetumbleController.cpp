@@ -0,0 +1,145 @@
+/**
+ * @file DetumbleController.cpp
+ *
+ * @details Implementation for the detumble mode controller
+ *
+ * Last Edited
+ * 2026-10-17
+**/
+
+#include "DetumbleController.hpp"
+
+DetumbleController::DetumbleController(
+    std::unordered_map<std::string, std::shared_ptr<Sensor>> sensors,
+    std::unordered_map<std::string, std::shared_ptr<Actuator>> actuators,
+    ADCS_timer *timer
+) : executive(timer) {
+    this->timer = timer;
+
+    for (const auto &s : sensors) {
+        if (Magnetometer* magnetometer = dynamic_cast<Magnetometer*>(s.second.get())) {
+            this->magnetometer = magnetometer;
+        }
+        else if (Gyroscope* gyro = dynamic_cast<Gyroscope*>(s.second.get())) {
+            this->gyro = gyro;
+        }
+    }
+
+    if (nullptr == this->magnetometer) {
+        throw invalid_adcs_param("Detumbling needs a magnetometer.");
+    }
+
+    for (const auto &a : actuators) {
+        if (Magnetorquer* torquer = dynamic_cast<Magnetorquer*>(a.second.get())) {
+            this->magnetorquers.push_back(torquer);
+        }
+    }
+
+    int num_torquers = this->magnetorquers.size();
+    Eigen::Matrix3Xf A(3, num_torquers);
+    this->lower_dipoles.resize(num_torquers);
+    this->upper_dipoles.resize(num_torquers);
+    this->dipoles.resize(num_torquers);
+
+    for (int i = 0; i < num_torquers; i++) {
+        A.col(i) = this->magnetorquers[i]->get_axis_of_rotation();
+        this->upper_dipoles(i) = this->magnetorquers[i]->get_max_dipole();
+        this->lower_dipoles(i) = -this->upper_dipoles(i);
+    }
+
+    if (!this->allocator.set_axes(A)) {
+        throw invalid_adcs_param("Magnetorquer axes must span all three axes.");
+    }
+
+    this->executive.add_task("b-dot", bdot_period, bdot_budget, [this]() { this->bdot_task(); });
+}
+
+void DetumbleController::begin(float detumble_rate) {
+    measurement initial_vals = this->take_field_measurement();
+    this->detumble_rate = detumble_rate;
+    this->detumbled = false;
+    this->start = initial_vals.time_taken;
+    this->detumble_time = 0;
+    this->prev_time = this->start;
+    this->prev_direction = initial_vals.vec.normalized();
+
+    this->executive.run(this->start + bdot_period);
+}
+
+const Executive &DetumbleController::get_executive() const {
+    return this->executive;
+}
+
+bool DetumbleController::is_detumbled() const {
+    return this->detumbled;
+}
+
+timestamp DetumbleController::get_detumble_time() const {
+    return this->detumble_time;
+}
+
+uint32_t DetumbleController::get_rejected_commands() const {
+    return this->rejected_commands;
+}
+
+void DetumbleController::bdot_task() {
+    measurement m = this->take_field_measurement();
+    float field = m.vec.norm();
+    float delta_t = (float) (m.time_taken - prev_time);
+
+    // Without a field, or a new measurement, there is no rate to oppose
+    if ((field <= 0) || (delta_t <= 0)) {
+        this->command_dipole(Eigen::Vector3f::Zero());
+        return;
+    }
+
+    // The rate of the field direction is the body rate across the field, so the law does not
+    // depend on the strength of the field or on the orbit moving the field
+    Eigen::Vector3f direction = m.vec / field;
+    Eigen::Vector3f direction_rate = (direction - prev_direction) / delta_t;
+    prev_direction = direction;
+    prev_time = m.time_taken;
+
+    if (!detumbled) {
+        float rate = (nullptr != this->gyro) ? this->take_rate_measurement() : direction_rate.norm();
+        if (rate < detumble_rate) {
+            detumbled = true;
+            detumble_time = m.time_taken - start;
+        }
+    }
+
+    if (detumbled) {
+        this->command_dipole(Eigen::Vector3f::Zero());
+    }
+    else {
+        this->command_dipole(-(bdot_gain / field) * direction_rate);
+    }
+}
+
+void DetumbleController::command_dipole(const Eigen::Vector3f &dipole) {
+    allocator.allocate(dipole, lower_dipoles, upper_dipoles, dipoles);
+
+    for (size_t i = 0; i < magnetorquers.size(); i++) {
+        if (!command_magnetorquer(magnetorquers[i], dipoles(i), this->timer)) {
+            this->rejected_commands++;
+        }
+    }
+}
+
+measurement DetumbleController::take_field_measurement() {
+    device_result<measurement> result = this->magnetometer->try_take_measurement();
+    while (!result) {
+        this->timer->sleep(result.time_until_ready);
+        result = this->magnetometer->try_take_measurement();
+    }
+    return result.value;
+}
+
+float DetumbleController::take_rate_measurement() {
+    device_result<gyro_state> result = this->gyro->try_take_measurement();
+    while (!result) {
+        this->timer->sleep(result.time_until_ready);
+        result = this->gyro->try_take_measurement();
+    }
+    return result.value.velocity.norm();
+}
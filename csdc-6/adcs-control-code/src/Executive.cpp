@@ -0,0 +1,108 @@
+/**
+ * @file Executive.cpp
+ *
+ * @details Implementation for the cooperative rate-monotonic executive
+ *
+ * Last Edited
+ * 2026-10-17
+**/
+
+#include <algorithm>
+
+#include "Executive.hpp"
+
+Executive::Executive(ADCS_timer *timer) {
+    if (nullptr == timer) {
+        throw invalid_adcs_param("pointer to timer was null in Executive");
+    }
+
+    this->timer = timer;
+}
+
+size_t Executive::add_task(const std::string &name, timestamp period, timestamp budget, std::function<void()> function) {
+    if (0 >= period) {
+        throw invalid_adcs_param("Task period must be positive.");
+    }
+
+    // Keep the tasks in priority order, after any task with the same period
+    auto position = std::upper_bound(this->tasks.begin(), this->tasks.end(), period,
+                                     [](timestamp p, const Executive::task &t) { return p < t.period; });
+    size_t inserted = position - this->tasks.begin();
+    this->tasks.insert(position, { name, period, budget, std::move(function), timestamp(), {} });
+
+    for (size_t &i : this->order) {
+        if (i >= inserted) {
+            i++;
+        }
+    }
+    this->order.push_back(inserted);
+
+    return this->order.size() - 1;
+}
+
+void Executive::run(timestamp first_release) {
+    for (task &t : this->tasks) {
+        t.release = first_release;
+    }
+
+    this->now = this->timer->get_time();
+    while (true) {
+        this->run_next();
+    }
+}
+
+void Executive::run_next() {
+    task *ready = nullptr;
+    task *next = nullptr;
+    for (task &t : this->tasks) {
+        if (t.release <= this->now) {
+            ready = &t;
+            break;
+        }
+        if ((nullptr == next) || (t.release < next->release)) {
+            next = &t;
+        }
+    }
+
+    if (nullptr == ready) {
+        if (nullptr == next) {
+            throw invalid_adcs_param("Executive has no tasks to run.");
+        }
+        this->now = this->timer->sleep(next->release - this->now);
+        return;
+    }
+
+    timestamp start = this->now;
+    ready->function();
+    this->now = this->timer->get_time();
+
+    timestamp run_time = this->now - start;
+    task_stats &stats = ready->stats;
+    stats.releases++;
+    stats.total_run_time += run_time;
+    stats.max_run_time = std::max(stats.max_run_time, run_time);
+    if (run_time > ready->budget) {
+        stats.overruns++;
+    }
+
+    ready->release += ready->period;
+    if (this->now > ready->release) {
+        stats.deadline_misses++;
+    }
+    while (this->now >= ready->release + ready->period) {
+        ready->release += ready->period;
+        stats.skipped_releases++;
+    }
+}
+
+size_t Executive::num_tasks() const {
+    return this->tasks.size();
+}
+
+const std::string &Executive::get_task_name(size_t index) const {
+    return this->tasks[this->order.at(index)].name;
+}
+
+const task_stats &Executive::get_stats(size_t index) const {
+    return this->tasks[this->order.at(index)].stats;
+}
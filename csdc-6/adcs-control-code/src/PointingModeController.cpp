@@ -9,54 +9,170 @@
  * 2022-11-13
 **/
 
+#include <algorithm>
+
 #include "PointingModeController.hpp"
 
 PointingModeController::PointingModeController(
     std::unordered_map<std::string, std::shared_ptr<Sensor>> sensors,
     std::unordered_map<std::string, std::shared_ptr<Actuator>> actuators,
     ADCS_timer *timer
-) {
+) : executive(timer) {
     this->sensors = sensors;
     this->actuators = actuators;
     this->timer = timer;
 
+    this->gyro = nullptr;
     for (const auto &s : sensors) {
         if (Gyroscope* gyro = dynamic_cast<Gyroscope*>(s.second.get())) {
             this->gyro = gyro;
         }
+        else if (Magnetometer* magnetometer = dynamic_cast<Magnetometer*>(s.second.get())) {
+            this->magnetometer = magnetometer;
+        }
+    }
+
+    if (nullptr == this->gyro) {
+        throw invalid_adcs_param("Pointing needs a gyroscope.");
+    }
+
+    // The attitude loop runs at the rate new measurements arrive
+    this->estimation_period = this->gyro->get_polling_time();
+    this->attitude_period = this->estimation_period;
+
+    std::vector<Reaction_wheel *> reaction_wheels;
+    this->wheel_period = this->estimation_period;
+    for (const auto &a : actuators) {
+        if (Reaction_wheel* rw = dynamic_cast<Reaction_wheel*>(a.second.get())) {
+            reaction_wheels.push_back(rw);
+            this->wheel_period = std::max(this->wheel_period, rw->get_polling_time());
+        }
+        else if (Magnetorquer* torquer = dynamic_cast<Magnetorquer*>(a.second.get())) {
+            this->magnetorquers.push_back(torquer);
+        }
+    }
+    this->set_reaction_wheels(reaction_wheels);
+
+    // Momentum dumping is optional, so torquers that can not dump every axis are left unused
+    bool dump_momentum = (nullptr != this->magnetometer) && !this->magnetorquers.empty();
+    if (dump_momentum) {
+        int num_torquers = this->magnetorquers.size();
+        Eigen::Matrix3Xf A(3, num_torquers);
+        this->lower_dipoles.resize(num_torquers);
+        this->upper_dipoles.resize(num_torquers);
+        this->dipoles.resize(num_torquers);
+
+        for (int i = 0; i < num_torquers; i++) {
+            A.col(i) = this->magnetorquers[i]->get_axis_of_rotation();
+            this->upper_dipoles(i) = this->magnetorquers[i]->get_max_dipole();
+            this->lower_dipoles(i) = -this->upper_dipoles(i);
+        }
+
+        dump_momentum = this->dipole_allocator.set_axes(A);
+    }
+
+    this->filter.set_process_noise(gyro_rate_noise, gyro_bias_noise);
+
+    this->executive.add_task("estimation", estimation_period, estimation_budget, [this]() { this->estimation_task(); });
+    this->executive.add_task("attitude", attitude_period, attitude_budget, [this]() { this->attitude_task(); });
+    this->executive.add_task("reaction wheels", wheel_period, wheel_budget, [this]() { this->wheel_task(); });
+    if (dump_momentum) {
+        this->executive.add_task("momentum", momentum_period, momentum_budget, [this]() { this->momentum_task(); });
     }
 }
 
-void PointingModeController::begin(Eigen::Vector3f desired_attitude, timestamp ramp_time) {
-    while (this->gyro->time_until_ready() > 0) {
-        this->timer->sleep(this->gyro->time_until_ready());
+void PointingModeController::set_reaction_wheels(const std::vector<Reaction_wheel *> &reaction_wheels) {
+    int num_rws = reaction_wheels.size();
+    Eigen::Matrix3Xf A(3, num_rws);
+    this->max_torques.resize(num_rws);
+    this->max_momenta.resize(num_rws);
+
+    for (int i = 0; i < num_rws; i++) {
+        Reaction_wheel *rw = reaction_wheels[i];
+        A.col(i) = rw->get_axis_of_rotation();
+        this->max_torques(i) = torque_margin * rw->get_max_acceleration() * rw->get_inertia_matrix();
+        this->max_momenta(i) = torque_margin * rw->get_max_velocity() * rw->get_inertia_matrix();
     }
 
-    measurement initial_vals = this->take_updated_measurements();
-    Eigen::Vector3f initial_attitude = initial_vals.vec;
-    timestamp start = initial_vals.time_taken;
-    timestamp prev_time = start;
+    if (!this->allocator.set_axes(A)) {
+        throw invalid_adcs_param("Reaction wheel axes must span all three axes.");
+    }
+
+    this->reaction_wheels = reaction_wheels;
+    this->rw_states.resize(num_rws);
+    this->rw_torques.resize(num_rws);
+    this->lower_torques.resize(num_rws);
+    this->upper_torques.resize(num_rws);
+}
+
+void PointingModeController::begin(Eigen::Vector3f desired_attitude, timestamp ramp_time) {
+    gyro_state initial_vals = this->take_updated_measurements();
+    this->filter.initialize(AttitudeFilter::exp(initial_vals.position), initial_vals.velocity, attitude_sigma, initial_bias_sigma);
+    this->desired_attitude = desired_attitude;
+    this->ramp_time = ramp_time;
+    this->initial_attitude = this->filter.get_attitude_vector();
+    this->start = initial_vals.time_taken;
+    this->prev_time = this->start;
+    this->estimate_time = this->start;
 
     prev_error = Eigen::Vector3f::Zero();
     prev_derivative = Eigen::Vector3f::Zero();
     prev_integral = Eigen::Vector3f::Zero();
+    desired_torque = Eigen::Vector3f::Zero();
+
+    this->executive.run(this->start + attitude_period);
+}
+
+const Executive &PointingModeController::get_executive() const {
+    return this->executive;
+}
+
+void PointingModeController::set_field_reference(std::function<Eigen::Vector3f(timestamp)> field_reference) {
+    this->field_reference = field_reference;
+}
+
+uint32_t PointingModeController::get_rejected_commands() const {
+    return this->rejected_commands;
+}
+
+void PointingModeController::estimation_task() {
+    gyro_state m = this->take_updated_measurements();
+    this->filter.propagate(m.velocity, (float) (m.time_taken - estimate_time));
+    this->filter.update_attitude(AttitudeFilter::exp(m.position), attitude_sigma);
+    estimate_time = m.time_taken;
 
-    while(true) {
-        try {
-            measurement m = this->take_updated_measurements();
-            timestamp delta_t = m.time_taken - prev_time;
-            timestamp since_start = m.time_taken - start;
-            prev_time = m.time_taken;
-
-            float ramp_factor = since_start < ramp_time ? ((float) since_start / (float) ramp_time) : 1;
-            Eigen::Vector3f ramped_desired_attitude = ramp_factor * (desired_attitude - initial_attitude) + initial_attitude;
-            this->update(m.vec, ramped_desired_attitude, delta_t);
-        } catch (device_not_ready &_e) {
-            this->timer->sleep(this->gyro->time_until_ready());
+    // Waiting for the magnetometer would delay the attitude loop, so its measurements are used
+    // whenever they are ready
+    if (nullptr == this->magnetometer) {
+        return;
+    }
+
+    device_result<measurement> result = this->magnetometer->try_take_measurement();
+    if (!result) {
+        return;
+    }
+
+    this->field_measurement = result.value;
+    this->field_measured = true;
+
+    if (this->field_reference) {
+        const Eigen::Vector3f reference = this->field_reference(this->field_measurement.time_taken);
+        if ((this->field_measurement.vec.squaredNorm() > 0) && (reference.squaredNorm() > 0)) {
+            this->filter.update_vector(this->field_measurement.vec, reference, field_sigma);
         }
     }
 }
 
+void PointingModeController::attitude_task() {
+    timestamp delta_t = estimate_time - prev_time;
+    timestamp since_start = estimate_time - start;
+    prev_time = estimate_time;
+
+    float ramp_factor = since_start < ramp_time ? ((float) since_start / (float) ramp_time) : 1;
+    Eigen::Vector3f ramped_desired_attitude = ramp_factor * (desired_attitude - initial_attitude) + initial_attitude;
+    this->update(this->filter.get_attitude_vector(), ramped_desired_attitude, delta_t);
+}
+
 void PointingModeController::update(Eigen::Vector3f current_attitude, Eigen::Vector3f desired_attitude, timestamp delta_t) {
     Eigen::Vector3f kp(0.0002, 0.0002, 0.0002);
     Eigen::Vector3f kd(0.005544, 0.005775, 0.0052472);
@@ -71,51 +187,92 @@ void PointingModeController::update(Eigen::Vector3f current_attitude, Eigen::Vec
     prev_derivative = cur_derivative;
     prev_integral = cur_integral;
 
-    Eigen::Vector3f desired_torque = -1 * (kp.cwiseProduct(cur_error) + cur_derivative + ki.cwiseProduct(cur_integral));
-    
-    int num_rws = actuators.size();
-    int i = 0;
-    Eigen::Matrix3Xf A;
-    A.resize(3, num_rws);
-    for (const auto &a : actuators) {
-        if (Reaction_wheel* rw = dynamic_cast<Reaction_wheel*>(a.second.get())) {
-            A.col(i++) << rw->get_axis_of_rotation();
-        }
+    desired_torque = -1 * (kp.cwiseProduct(cur_error) + cur_derivative + ki.cwiseProduct(cur_integral));
+}
+
+void PointingModeController::wheel_task() {
+    // Limit each wheel's torque so it does not pass its max speed before the next command
+    const float delta_t = (float) wheel_period;
+    for (size_t i = 0; i < reaction_wheels.size(); i++) {
+        rw_states[i] = reaction_wheels[i]->get_current_state();
+        float momentum = rw_states[i].velocity * reaction_wheels[i]->get_inertia_matrix();
+        lower_torques(i) = std::max(-max_torques(i), std::min(0.0f, (-max_momenta(i) - momentum) / delta_t));
+        upper_torques(i) = std::min(max_torques(i), std::max(0.0f, (max_momenta(i) - momentum) / delta_t));
     }
 
-    Eigen::VectorXf rw_torques = A.transpose() * (A * A.transpose()).inverse() * desired_torque;
+    allocator.allocate(desired_torque, lower_torques, upper_torques, rw_torques);
 
-    // Check each torque to make sure it doesn't exceed the max, if it does
-    i = 0;
-    for (const auto &a : actuators) {
-        if (Reaction_wheel* rw = dynamic_cast<Reaction_wheel*>(a.second.get())) {
-            float max_t = rw->get_max_acceleration() * rw->get_inertia_matrix();
-            float rw_t = rw_torques[i++];
-            if (abs(rw_t) >= max_t) {
-                rw_torques = rw_torques * max_t / abs(rw_t) * 0.99;
-            }
-        }
+    for (size_t i = 0; i < reaction_wheels.size(); i++) {
+        Reaction_wheel *rw = reaction_wheels[i];
+        this->command_wheel(rw, {
+            rw_torques(i) / rw->get_inertia_matrix(),
+            rw_states[i].velocity,
+            rw_states[i].position,
+            this->timer->get_time()
+        });
+    }
+}
+
+void PointingModeController::command_wheel(Reaction_wheel *rw, actuator_state target) {
+    device_result<actuator_state> result = rw->try_set_target_state(target);
+
+    // The wheel period covers every polling time, so a wheel is only not ready when the last
+    // command was late, and only for a short time
+    if (device_status::not_ready == result.status) {
+        this->timer->sleep(result.time_until_ready);
+        target.time = this->timer->get_time();
+        result = rw->try_set_target_state(target);
     }
 
-    i = 0;
-    for (const auto &a : actuators) {
-        if (Reaction_wheel* rw = dynamic_cast<Reaction_wheel*>(a.second.get())) {
-            rw->set_target_state({ 
-                rw_torques.coeff(i, 0) / rw->get_inertia_matrix(), 
-                rw->get_current_state().velocity, 
-                rw->get_current_state().position,
-                this->timer->get_time() 
-            });
-            i++;
+    // The dynamics can carry a wheel just past its max speed, which is still a valid state to
+    // command it from
+    if (device_status::invalid_state == result.status) {
+        float max_acceleration = rw->get_max_acceleration();
+        float max_velocity = rw->get_max_velocity();
+        target.acceleration = std::max(-max_acceleration, std::min(target.acceleration, max_acceleration));
+        target.velocity = std::max(-max_velocity, std::min(target.velocity, max_velocity));
+        result = rw->try_set_target_state(target);
+    }
+
+    if (!result) {
+        this->rejected_commands++;
+    }
+}
+
+void PointingModeController::momentum_task() {
+    // The field is read by the estimation task, so there is none until its first measurement
+    if (!this->field_measured) {
+        return;
+    }
+
+    // The wheel states are from the last run of the wheel task
+    Eigen::Vector3f momentum = Eigen::Vector3f::Zero();
+    for (size_t i = 0; i < reaction_wheels.size(); i++) {
+        momentum += reaction_wheels[i]->get_axis_of_rotation() * reaction_wheels[i]->get_inertia_matrix() * rw_states[i].velocity;
+    }
+
+    // m = k h x B / |B|^2 gives the torque m x B = -k h across the field
+    const Eigen::Vector3f &field = this->field_measurement.vec;
+    float field_squared = field.squaredNorm();
+    Eigen::Vector3f desired_dipole = Eigen::Vector3f::Zero();
+    if (field_squared > 0) {
+        desired_dipole = (dump_gain / field_squared) * momentum.cross(field);
+    }
+
+    dipole_allocator.allocate(desired_dipole, lower_dipoles, upper_dipoles, dipoles);
+
+    for (size_t i = 0; i < magnetorquers.size(); i++) {
+        if (!command_magnetorquer(magnetorquers[i], dipoles(i), this->timer)) {
+            this->rejected_commands++;
         }
     }
 }
 
-measurement PointingModeController::take_updated_measurements() {
-    try {
-        gyro_state state = this->gyro->take_measurement();
-        return { state.position, state.time_taken };
-    } catch (device_not_ready *e) {
-        throw e;
+gyro_state PointingModeController::take_updated_measurements() {
+    device_result<gyro_state> result = this->gyro->try_take_measurement();
+    while (!result) {
+        this->timer->sleep(result.time_until_ready);
+        result = this->gyro->try_take_measurement();
     }
+    return result.value;
 }
@@ -0,0 +1,224 @@
+/**
+ * @file SunSensorDecoder.cpp
+ *
+ * @details Implementation for the decoder of the two dimensional sun sensor
+ *
+ * Last Edited
+ * 2026-10-17
+**/
+
+#include <algorithm>
+#include <cmath>
+
+#include "SunSensorDecoder.hpp"
+#include "def_interface.hpp"
+
+namespace {
+
+using namespace sun_sensor_calibration;
+
+typedef std::array<std::array<float, SunSensorDecoder::lut_size>, num_diodes> angle_table;
+
+/* Lowest voltage of the calibration, below it a diode is in the dark */
+constexpr float min_voltage = voltage[0][0];
+
+/* Voltage between the entries of the tables */
+constexpr float voltage_step = (1.0f - min_voltage) / (SunSensorDecoder::lut_size - 1);
+
+constexpr float wrap_degrees(float angle) {
+    while (angle > 180.0f) {
+        angle -= 360.0f;
+    }
+    while (angle <= -180.0f) {
+        angle += 360.0f;
+    }
+    return angle;
+}
+
+// Linear interpolation of one side of a diode at a voltage within its calibration
+constexpr float calibrated_angle(const std::array<float, num_points> &voltages,
+                                 const std::array<float, num_points> &angles, float v) {
+    size_t i = 1;
+    while ((i < num_points - 1) && (voltages[i] < v)) {
+        i++;
+    }
+    float fraction = (v - voltages[i - 1]) / (voltages[i] - voltages[i - 1]);
+    return angles[i - 1] + fraction * (angles[i] - angles[i - 1]);
+}
+
+constexpr angle_table resample(const std::array<std::array<float, num_points>, num_diodes> &angles) {
+    angle_table table = {};
+    for (size_t diode = 0; diode < num_diodes; diode++) {
+        for (size_t j = 0; j < SunSensorDecoder::lut_size; j++) {
+            table[diode][j] = calibrated_angle(voltage[diode], angles[diode], min_voltage + j * voltage_step);
+        }
+    }
+    return table;
+}
+
+/* The angle of each side of each diode at evenly spaced voltages, in degrees */
+constexpr angle_table top_table = resample(angle_top);
+constexpr angle_table bot_table = resample(angle_bot);
+
+constexpr float magnitude(float value) {
+    return (value < 0) ? -value : value;
+}
+
+// The angle a diode faces, midway between the two sides at full voltage
+constexpr float peak_angle(size_t diode) {
+    float top_end = angle_top[diode][num_points - 1];
+    float bot_end = angle_bot[diode][num_points - 1];
+    return wrap_degrees(bot_end + 0.5f * wrap_degrees(top_end - bot_end));
+}
+
+// Voltage of one side of a diode at an offset from its peak, as a fraction of the largest voltage
+constexpr float side_response(const std::array<float, num_points> &angles, size_t diode, float peak, float offset) {
+    size_t i = 1;
+    while ((i < num_points - 1) && (magnitude(wrap_degrees(angles[i] - peak)) > magnitude(offset))) {
+        i++;
+    }
+    float start = wrap_degrees(angles[i - 1] - peak);
+    float end = wrap_degrees(angles[i] - peak);
+    float fraction = (offset - start) / (end - start);
+    return voltage[diode][i - 1] + fraction * (voltage[diode][i] - voltage[diode][i - 1]);
+}
+
+// Voltage of a diode with the sun at an angle, as a fraction of the largest voltage, 0 in the dark
+constexpr float response(size_t diode, float angle) {
+    float peak = peak_angle(diode);
+    float offset = wrap_degrees(angle - peak);
+    float top_peak = wrap_degrees(angle_top[diode][num_points - 1] - peak);
+    float bot_peak = wrap_degrees(angle_bot[diode][num_points - 1] - peak);
+
+    if ((offset >= bot_peak) && (offset <= top_peak)) {
+        return 1;
+    }
+    if ((offset > top_peak) && (offset <= wrap_degrees(angle_top[diode][0] - peak))) {
+        return side_response(angle_top[diode], diode, peak, offset);
+    }
+    if ((offset < bot_peak) && (offset >= wrap_degrees(angle_bot[diode][0] - peak))) {
+        return side_response(angle_bot[diode], diode, peak, offset);
+    }
+    return 0;
+}
+
+// Difference of the voltages of a diode and the next over their sum, at a fraction of the way
+// from the peak of the diode to the peak of the next. The sunlight reaching the sensor cancels.
+constexpr float pair_ratio(size_t diode, float fraction) {
+    size_t next = (diode + 1) % num_diodes;
+    float start = peak_angle(diode);
+    float angle = wrap_degrees(start + fraction * wrap_degrees(peak_angle(next) - start));
+    float first = response(diode, angle);
+    float second = response(next, angle);
+    return (second - first) / (second + first);
+}
+
+constexpr angle_table build_pair_table() {
+    angle_table table = {};
+    for (size_t diode = 0; diode < num_diodes; diode++) {
+        float start = peak_angle(diode);
+        float arc = wrap_degrees(peak_angle((diode + 1) % num_diodes) - start);
+
+        // The ratio rises from the peak of the diode to the peak of the next, so each entry is
+        // found by bisection
+        for (size_t j = 0; j < SunSensorDecoder::lut_size; j++) {
+            float ratio = -1.0f + j * (2.0f / (SunSensorDecoder::lut_size - 1));
+            float low = 0;
+            float high = 1;
+            for (int k = 0; k < 24; k++) {
+                float middle = 0.5f * (low + high);
+                if (pair_ratio(diode, middle) < ratio) {
+                    low = middle;
+                }
+                else {
+                    high = middle;
+                }
+            }
+            table[diode][j] = wrap_degrees(start + 0.5f * (low + high) * arc);
+        }
+    }
+    return table;
+}
+
+/* The angle of the sun between each diode and the next at evenly spaced ratios of their voltages,
+   from -1 at the peak of the diode to 1 at the peak of the next, in degrees */
+constexpr angle_table pair_table = build_pair_table();
+
+// The voltage is a fraction of the largest voltage, at least min_voltage
+inline float lookup(const angle_table &table, size_t diode, float v) {
+    float position = std::min((v - min_voltage) / voltage_step, (float) (SunSensorDecoder::lut_size - 1));
+    size_t i = std::min((size_t) position, SunSensorDecoder::lut_size - 2);
+    float fraction = position - i;
+    return table[diode][i] + fraction * (table[diode][i + 1] - table[diode][i]);
+}
+
+// The ratio is between -1 and 1, and the table crosses 180 degrees between some diodes
+inline float lookup_pair(size_t diode, float ratio) {
+    float position = std::max(0.0f, std::min((ratio + 1.0f) * 0.5f * (SunSensorDecoder::lut_size - 1),
+                                             (float) (SunSensorDecoder::lut_size - 1)));
+    size_t i = std::min((size_t) position, SunSensorDecoder::lut_size - 2);
+    float fraction = position - i;
+    return wrap_degrees(pair_table[diode][i] + fraction * wrap_degrees(pair_table[diode][i + 1] - pair_table[diode][i]));
+}
+
+}
+
+SunSensorDecoder::SunSensorDecoder(Eigen::Vector3f axis, Eigen::Vector3f normal, float max_voltage) {
+    Eigen::Vector3f unit_normal = normal.normalized();
+    Eigen::Vector3f in_plane = axis - axis.dot(unit_normal) * unit_normal;
+
+    if ((max_voltage <= 0) || (in_plane.norm() < 1e-3f * axis.norm()) || (normal.norm() == 0)) {
+        throw invalid_adcs_param("Sun sensor axis must be in its plane, and its max voltage positive.");
+    }
+
+    this->axis = in_plane.normalized();
+    this->perpendicular = unit_normal.cross(this->axis);
+    this->voltage_scale = 1.0f / max_voltage;
+}
+
+bool SunSensorDecoder::decode(const Eigen::Vector4f &voltages, float &angle) const {
+    Eigen::Vector4f v = voltage_scale * voltages;
+
+    int brightest = 0;
+    v.maxCoeff(&brightest);
+    if (v(brightest) < min_voltage) {
+        return false;
+    }
+
+    // Each diode faces 90 degrees clockwise of the one before it, so the sun is between the
+    // brightest diode and whichever of its neighbours is brighter
+    size_t next = (brightest + 1) % num_diodes;
+    size_t prev = (brightest + num_diodes - 1) % num_diodes;
+    bool towards_next = v(next) >= v(prev);
+    size_t neighbour = towards_next ? next : prev;
+
+    // A lit diode is at least min_voltage of the largest voltage whatever the sunlight reaching
+    // the plane of the sensor, so the neighbour is compared with the brightest diode. Alone, the
+    // brightest diode sees the sun near its peak, but not on which side of it, so the middle of
+    // the two sides is the smallest error either way
+    if (v(neighbour) < min_voltage * v(brightest)) {
+        float top_angle = lookup(top_table, brightest, std::min(v(brightest), 1.0f));
+        float bot_angle = lookup(bot_table, brightest, std::min(v(brightest), 1.0f));
+        angle = wrap_degrees(bot_angle + 0.5f * wrap_degrees(top_angle - bot_angle)) * (float) M_PI / 180.0f;
+        return true;
+    }
+
+    // The sunlight out of the plane of the sensor scales both voltages of the pair, so their
+    // ratio is used rather than either voltage
+    size_t first = towards_next ? brightest : neighbour;
+    size_t second = towards_next ? neighbour : brightest;
+    float ratio = (v(second) - v(first)) / (v(second) + v(first));
+
+    angle = lookup_pair(first, ratio) * (float) M_PI / 180.0f;
+    return true;
+}
+
+bool SunSensorDecoder::sun_direction(const Eigen::Vector4f &voltages, Eigen::Vector3f &direction) const {
+    float angle = 0;
+    if (!this->decode(voltages, angle)) {
+        return false;
+    }
+
+    direction = std::cos(angle) * axis + std::sin(angle) * perpendicular;
+    return true;
+}
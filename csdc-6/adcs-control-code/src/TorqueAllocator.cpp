@@ -0,0 +1,118 @@
+/**
+ * @file TorqueAllocator.cpp
+ *
+ * @details Implementation for the reaction wheel torque allocator
+ *
+ * Last Edited
+ * 2026-10-17
+**/
+
+#include <algorithm>
+
+#include "TorqueAllocator.hpp"
+
+bool TorqueAllocator::set_axes(const Eigen::Matrix3Xf &axes) {
+    Eigen::Matrix3f A_A_t = axes * axes.transpose();
+    if (!A_A_t.fullPivLu().isInvertible()) {
+        return false;
+    }
+
+    this->A = axes;
+    this->A_gen_inv = axes.transpose() * A_A_t.inverse();
+    this->saturated.assign(axes.cols(), false);
+    this->candidate.resize(axes.cols());
+    return true;
+}
+
+float TorqueAllocator::allocate(const Eigen::Vector3f &desired_torque, const Eigen::VectorXf &lower,
+                                const Eigen::VectorXf &upper, Eigen::VectorXf &torques) {
+    if (this->redistribute(desired_torque, lower, upper, torques)) {
+        return 1;
+    }
+
+    // The torque can not be reached. Scaling the minimum norm solution down until every wheel is
+    // within its bounds always works, so start the search from there.
+    torques.noalias() = this->A_gen_inv * desired_torque;
+    float reachable = 1;
+    for (Eigen::Index i = 0; i < torques.size(); i++) {
+        if (torques(i) > upper(i)) {
+            reachable = std::min(reachable, upper(i) / torques(i));
+        } else if (torques(i) < lower(i)) {
+            reachable = std::min(reachable, lower(i) / torques(i));
+        }
+    }
+    torques *= reachable;
+
+    // Redistributing reaches further than scaling, search for the largest fraction it can reach
+    float unreachable = 1;
+    for (int step = 0; step < bisection_steps; step++) {
+        float fraction = (reachable + unreachable) / 2;
+        if (this->redistribute(fraction * desired_torque, lower, upper, this->candidate)) {
+            reachable = fraction;
+            torques = this->candidate;
+        } else {
+            unreachable = fraction;
+        }
+    }
+
+    return reachable;
+}
+
+bool TorqueAllocator::redistribute(const Eigen::Vector3f &torque, const Eigen::VectorXf &lower,
+                                   const Eigen::VectorXf &upper, Eigen::VectorXf &torques) {
+    const Eigen::Index num_rws = this->A.cols();
+    std::fill(this->saturated.begin(), this->saturated.end(), false);
+
+    // With no wheel saturated the solution is the precomputed minimum norm one
+    torques.noalias() = this->A_gen_inv * torque;
+
+    // Each pass fixes at least one more wheel, so there are at most num_rws passes
+    for (Eigen::Index pass = 0; pass < num_rws; pass++) {
+        bool violated = false;
+        for (Eigen::Index i = 0; i < num_rws; i++) {
+            if (this->saturated[i]) {
+                continue;
+            }
+            if (torques(i) > upper(i)) {
+                torques(i) = upper(i);
+                this->saturated[i] = true;
+                violated = true;
+            } else if (torques(i) < lower(i)) {
+                torques(i) = lower(i);
+                this->saturated[i] = true;
+                violated = true;
+            }
+        }
+
+        if (!violated) {
+            return true;
+        }
+
+        // Find the minimum norm solution for the free wheels to the torque the fixed ones miss
+        Eigen::Vector3f remaining = torque;
+        Eigen::Matrix3f A_A_t = Eigen::Matrix3f::Zero();
+        for (Eigen::Index i = 0; i < num_rws; i++) {
+            if (this->saturated[i]) {
+                remaining -= this->A.col(i) * torques(i);
+            } else {
+                A_A_t += this->A.col(i) * this->A.col(i).transpose();
+            }
+        }
+
+        Eigen::Matrix3f A_A_t_inv;
+        bool invertible = false;
+        A_A_t.computeInverseWithCheck(A_A_t_inv, invertible, singular_threshold);
+        if (!invertible) {
+            return false;
+        }
+
+        Eigen::Vector3f y = A_A_t_inv * remaining;
+        for (Eigen::Index i = 0; i < num_rws; i++) {
+            if (!this->saturated[i]) {
+                torques(i) = this->A.col(i).dot(y);
+            }
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file    AllocationCounter.hpp
+ *
+ * @details Counts the heap allocations made by the simulator, used by the performance tests to
+ *          check that the simulation does not allocate memory every timestep.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <cstdint>
+
+namespace AllocationCounter
+{
+    /**
+     * @name    is_supported
+     *
+     * @returns true if allocations can be counted on this platform. Counting relies on replacing
+     *          malloc and the rest of its family, which is only done with glibc.
+    **/
+    bool is_supported();
+
+    /**
+     * @name    get_allocations
+     *
+     * @returns the number of heap allocations made by the process so far, from all threads. This
+     *          includes allocations from new as well as from Eigen, which uses malloc or the
+     *          aligned allocation functions directly.
+    **/
+    uint64_t get_allocations();
+
+    /**
+     * @name    get_deallocations
+     *
+     * @returns the number of heap blocks freed by the process so far, from all threads.
+    **/
+    uint64_t get_deallocations();
+}
@@ -0,0 +1,237 @@
+/**
+ * @file    Campaign.hpp
+ *
+ * @details Header file for Monte-Carlo campaigns. A campaign runs many independent simulations of
+ *          the pointing mode controller from a base configuration, each with randomly perturbed
+ *          parameters, on a pool of threads, and collects summary metrics for every run.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "ConfigurationSingleton.hpp"
+#include "Messenger.hpp"
+
+/**
+ * @struct  campaign_config
+ *
+ * @details settings of a campaign, loaded from the campaign yaml. All perturbations are drawn
+ *          independently for each run.
+ *
+ * @param runs                  number of simulations to run.
+ * @param threads               number of simulations to run at once. 0 uses every core.
+ * @param seed                  seed of the campaign. Each run is seeded from this and its number,
+ *                              so a run can be repeated on its own.
+ * @param inertia               relative standard deviation of each principal moment of the
+ *                              satellite inertia tensor. The principal axes are kept.
+ * @param initial_velocity      standard deviation added to each axis of the initial satellite
+ *                              velocity, in rad/s.
+ * @param wheel_inertia         relative standard deviation of the inertia of each reaction wheel.
+ * @param polling_time          largest offset added to the polling time of each device, in ms.
+ *                              Drawn uniformly, and the polling time is kept at 1 ms or more.
+**/
+typedef struct
+{
+    uint32_t runs;
+    uint32_t threads;
+    uint32_t seed;
+    float    inertia;
+    float    initial_velocity;
+    float    wheel_inertia;
+    float    polling_time;
+} campaign_config;
+
+/**
+ * @struct  run_summary
+ *
+ * @details summary metrics of a single run of a campaign.
+ *
+ * @param run               number of the run in the campaign.
+ * @param completed         false if the run ended with an error instead of its timeout.
+ * @param final_error       angle between the final and desired position, in rad.
+ * @param settle_time       time after which the error stayed within the required accuracy, in s.
+ *                          Negative if the final error is outside the required accuracy.
+ * @param final_rate        magnitude of the final satellite angular velocity, in rad/s.
+ * @param max_wheel_speed   largest reaction wheel speed reached during the run, in rad/s.
+ * @param initial_cross_momentum
+ *                          momentum of the reaction wheels across the magnetic field when the
+ *                          magnetometer first measures it, the part magnetorquers can dump, in
+ *                          N*m*s. 0 without a field or wheels.
+ * @param final_cross_momentum
+ *                          momentum of the reaction wheels across the last field measured, in
+ *                          N*m*s.
+ * @param detumble_time     first time the satellite rate fell below the detumble rate, in s, when
+ *                          detumbling. 0 if it started below, negative if it never fell below or
+ *                          the run was pointing.
+ * @param rejected_commands number of actuator commands the controller could not apply.
+ * @param steps             number of simulation timesteps.
+ * @param wall_time         wall clock run time, in ms.
+**/
+typedef struct
+{
+    uint32_t run;
+    bool     completed;
+    float    final_error;
+    float    settle_time;
+    float    final_rate;
+    float    max_wheel_speed;
+    float    initial_cross_momentum;
+    float    final_cross_momentum;
+    float    detumble_time;
+    uint32_t rejected_commands;
+    uint64_t steps;
+    float    wall_time;
+} run_summary;
+
+/**
+ * @class   RunMonitor
+ *
+ * @details messenger for a single campaign run. All prints are silenced, and the state of every
+ *          timestep is reduced to the metrics of a run_summary instead.
+**/
+class RunMonitor : public Messenger
+{
+    public:
+        /**
+         * @name    RunMonitor constructor
+         *
+         * @param   desired_position    the position the controller is trying to reach.
+         * @param   required_accuracy   the accuracy the position must be held within, in rad.
+         * @param   detumble_rate       the rate the satellite counts as detumbled below, in rad/s.
+         *                              0 to not record a detumble time.
+        **/
+        RunMonitor(Eigen::Vector3f desired_position, float required_accuracy, float detumble_rate);
+
+        /**
+         * @name    update_simulation_state
+         *
+         * @details updates the run metrics with the state at the end of a timestep.
+        **/
+        void update_simulation_state(const sim_config &state, timestamp time, timestamp timestep) override;
+
+        /**
+         * @name    get_summary
+         *
+         * @returns the metrics of the run so far. The run number and wall time are not filled in.
+        **/
+        run_summary get_summary();
+
+    private:
+        /* the attitude the controller is trying to reach */
+        Eigen::Quaternionf desired_attitude;
+
+        /* the accuracy the position must be held within, in rad */
+        float required_accuracy;
+
+        /* the rate the satellite counts as detumbled below, in rad/s */
+        float detumble_rate;
+
+        /* latest time the position was outside the required accuracy */
+        timestamp last_violation = 0;
+
+        /* whether the magnetometer has measured the field yet */
+        bool field_measured = false;
+
+        /* the metrics collected so far */
+        run_summary summary = {};
+};
+
+/**
+ * @class   Campaign
+ *
+ * @details runs a Monte-Carlo campaign of the controller selected by the mode of the exit file.
+**/
+class Campaign
+{
+    public:
+        /**
+         * @name    Campaign constructor
+         *
+         * @param   base     configuration with both the config and exit yaml loaded. Every run
+         *                   starts from a copy of it.
+         * @param   settings the campaign settings.
+        **/
+        Campaign(const Configuration &base, campaign_config settings);
+
+        /**
+         * @name    load
+         *
+         * @details loads the campaign settings from a yaml file.
+         *
+         * @param   fileName [string], the campaign YAML file's name
+         * @param   settings filled with the settings of the file.
+         *
+         * @returns false if the file could not be loaded.
+        **/
+        static bool load(const std::string &fileName, campaign_config *settings);
+
+        /**
+         * @name    run
+         *
+         * @details runs every simulation of the campaign, and returns when all are finished.
+         *
+         * @returns the summary of each run, in order of the run number.
+        **/
+        std::vector<run_summary> run();
+
+        /**
+         * @name    run_single
+         *
+         * @details runs one simulation with the pointing mode controller until it times out. Safe
+         *          to call from several threads at once with different configurations.
+         *
+         * @param   config the configuration of the run, with the exit yaml loaded.
+         * @param   run    the number of the run.
+         *
+         * @returns the summary of the run.
+        **/
+        static run_summary run_single(Configuration &config, uint32_t run);
+
+        /**
+         * @name    perturb
+         *
+         * @details creates the configuration of a run by perturbing the base configuration.
+         *
+         * @param   run the number of the run.
+         *
+         * @returns the configuration of the run.
+        **/
+        Configuration perturb(uint32_t run) const;
+
+        /**
+         * @name    write_summary
+         *
+         * @details writes the summary of each run to a csv file.
+         *
+         * @param   results the results of the campaign.
+         * @param   path    path of the csv file.
+        **/
+        static void write_summary(const std::vector<run_summary> &results, const std::string &path);
+
+    private:
+        /* configuration every run starts from */
+        Configuration base;
+
+        /* the campaign settings */
+        campaign_config settings;
+
+        /* time the controller ramps to the desired position over, as in a single simulation */
+        static constexpr timestamp ramp_time = timestamp(0, 30);
+};
+
+/**
+ * @exception campaign_failure
+ *
+ * @details exception used to indicate that a campaign could not be run or saved.
+**/
+class campaign_failure : public adcs_exception
+{
+    public:
+        campaign_failure(const char* msg) :  adcs_exception(msg) {}
+};
@@ -11,27 +11,98 @@
 **/
 #pragma once
 
+#include <cmath>
+#include <cstdint>
 #include <Eigen/Dense>
+#include <Eigen/Geometry>
+#include <string>
 #include <vector>
 
+#include "SGP4.hpp"
+
 /**
 * @details enum class for sensor type, which defines all valid sensor types
 */
 enum class SensorType{
     Gyroscope,
-    Accelerometer
+    Accelerometer,
+    Magnetometer,
+    SunSensor
 };
 
 /**
 * @details enum class for actuator type, which defines all valid actuator types
 */
 enum class ActuatorType{
-    ReactionWheel
+    ReactionWheel,
+    Magnetorquer
+};
+
+/**
+* @details enum class for the time mode of the simulation, which defines how the time the control
+* code spends running between calls into the simulation is accounted for.
+*
+* Virtual   the run time of the control code is modelled with a cost per call. Runs are fully
+*           reproducible and are not paced by the wall clock.
+* RealTime  the run time of the control code is measured with the wall clock of the host.
+*/
+enum class TimeMode{
+    Virtual,
+    RealTime
+};
+
+/**
+* @details enum class for every call the control code can make into the simulation. Used to index
+* the controller cost table of the virtual time mode.
+*/
+enum class ControllerCall{
+    GetTime,
+    Sleep,
+    DeviceReady,
+    GyroscopeMeasurement,
+    AccelerometerMeasurement,
+    MagnetometerMeasurement,
+    SunSensorMeasurement,
+    ReactionWheelCommand,
+    ReactionWheelState,
+    MagnetorquerCommand,
+    Count
+};
+
+/* number of entries in the controller cost table */
+constexpr size_t num_controller_calls = static_cast<size_t>(ControllerCall::Count);
+
+/**
+* @details enum class for the mode the control code is run in.
+*
+* Pointing  points the satellite at the desired attitude with the reaction wheels.
+* Detumble  slows the rotation of the satellite with the magnetorquers.
+*/
+enum class ControlMode{
+    Pointing,
+    Detumble
+};
+
+/**
+* @details enum class for the numerical integration method used to propagate the simulation.
+*
+* Euler     first order semi-implicit Euler method.
+* RK4       classic fourth order Runge-Kutta method.
+* RK45      Dormand-Prince 5(4) method. With a variable timestep the step size is controlled by the
+*           embedded error estimate.
+*/
+enum class IntegratorType{
+    Euler,
+    RK4,
+    RK45
 };
 
 /**
 * @name Satellite
-* @property theta_b [Eigen::Vector3f], the angular position of the satellite body
+* @property attitude_b [Eigen::Quaternionf], the attitude of the satellite body, rotating body
+* coordinates into the inertial frame. This is the propagated attitude state.
+* @property theta_b [Eigen::Vector3f], the angular position of the satellite body as a rotation
+* vector (axis times angle, angle in [0, pi]). Derived from attitude_b after each timestep.
 * @property omega_b [Eigen::Vector3f], the angular velocity of the satellite body
 * @property alpha_b [Eigen::Vector3f], the angular acceleration of the satellite body
 * @property inertia_b [Eigen::Matrix3f], the inertia tensor of the satellite body
@@ -42,6 +113,7 @@ enum class ActuatorType{
 * coordinates in an arbitrary inertial frame of reference.
 */
 typedef struct {
+    Eigen::Quaternionf attitude_b;
     Eigen::Vector3f theta_b;
     Eigen::Vector3f omega_b;
     Eigen::Vector3f alpha_b;
@@ -49,24 +121,137 @@ typedef struct {
 } Satellite;
 
 /**
- * @struct  sim_reaction_wheel
+ * @struct  sim_wheel_bank
  * 
- * @details structure defining the status of a reaction wheel in the simulator.
+ * @details structure defining the status of every reaction wheel in the simulator, with one array
+ *          per value and one entry per wheel, so all the wheels can be updated together.
  * 
- * @param omega     the angular velocity of the reaciton wheel (body frame)
- * @param alpha     the angular acceleration of the reaction wheel (body frame)
- * @param inertia   the inertia matrix of the reaction wheel.
- * @param position  the position of the satellite of the reaction wheel
+ * @param omega             the angular velocity of each reaciton wheel (body frame)
+ * @param alpha             the angular acceleration of each reaction wheel (body frame), after
+ *                          friction and speed saturation.
+ * @param command           the angular acceleration commanded by the control code, limited to
+ *                          max_alpha.
+ * @param drive             the angular acceleration the motor is currently driving, which lags
+ *                          the command.
+ * @param inertia           the inertia of each reaction wheel about its axis.
+ * @param max_omega         speed the motor stops driving the wheel faster at.
+ * @param max_alpha         largest angular acceleration the motor can drive.
+ * @param time_constant     time constant of the motor, in s. 0 for a motor that responds instantly.
+ * @param coulomb_friction  constant friction torque against the spin of the wheel.
+ * @param viscous_friction  friction torque per unit of wheel speed.
+ * @param axis_of_rotation  the axis of rotation of each reaction wheel, one column per wheel.
+ * @param name              the name of each reaction wheel in the config, used to find it.
  * 
 **/
+typedef struct sim_wheel_bank
+{
+    Eigen::ArrayXf           omega;
+    Eigen::ArrayXf           alpha;
+    Eigen::ArrayXf           command;
+    Eigen::ArrayXf           drive;
+    Eigen::ArrayXf           inertia;
+    Eigen::ArrayXf           max_omega;
+    Eigen::ArrayXf           max_alpha;
+    Eigen::ArrayXf           time_constant;
+    Eigen::ArrayXf           coulomb_friction;
+    Eigen::ArrayXf           viscous_friction;
+    Eigen::Matrix3Xf         axis_of_rotation;
+    std::vector<std::string> name;
+
+    /**
+     * @name    size
+     *
+     * @returns the number of reaction wheels.
+    **/
+    Eigen::Index size() const { return omega.size(); }
+
+    /**
+     * @name    resize
+     *
+     * @details resizes every array to hold a number of reaction wheels, with their values unset.
+     *
+     * @param   num_wheels the number of reaction wheels.
+    **/
+    void resize(Eigen::Index num_wheels)
+    {
+        for (Eigen::ArrayXf *values : { &omega, &alpha, &command, &drive, &inertia, &max_omega, &max_alpha,
+                                        &time_constant, &coulomb_friction, &viscous_friction }) {
+            values->resize(num_wheels);
+        }
+        axis_of_rotation.resize(3, num_wheels);
+        name.resize(num_wheels);
+    }
+} sim_wheel_bank;
+
+/**
+ * @struct  sim_magnetorquer_bank
+ *
+ * @details structure defining the status of every magnetorquer in the simulator, with one array
+ *          per value and one entry per magnetorquer.
+ *
+ * @param dipole      the magnetic dipole commanded on each magnetorquer, in A*m^2.
+ * @param max_dipole  largest dipole each magnetorquer can produce, in A*m^2.
+ * @param axis        the axis of each magnetorquer, one column per magnetorquer.
+ * @param name        the name of each magnetorquer in the config, used to find it.
+ *
+**/
+typedef struct sim_magnetorquer_bank
+{
+    Eigen::ArrayXf           dipole;
+    Eigen::ArrayXf           max_dipole;
+    Eigen::Matrix3Xf         axis;
+    std::vector<std::string> name;
+
+    /**
+     * @name    size
+     *
+     * @returns the number of magnetorquers.
+    **/
+    Eigen::Index size() const { return dipole.size(); }
+
+    /**
+     * @name    resize
+     *
+     * @details resizes every array to hold a number of magnetorquers, with their values unset.
+     *
+     * @param   num_magnetorquers the number of magnetorquers.
+    **/
+    void resize(Eigen::Index num_magnetorquers)
+    {
+        dipole.resize(num_magnetorquers);
+        max_dipole.resize(num_magnetorquers);
+        axis.resize(3, num_magnetorquers);
+        name.resize(num_magnetorquers);
+    }
+} sim_magnetorquer_bank;
+
+/**
+ * @struct  sensor_noise
+ *
+ * @details error model of a sensor, applied to each measurement as
+ *          round((I + diag(scale_factor)) (I + [misalignment x]) truth + bias + white noise).
+ *          The default model is a perfect sensor.
+ *
+ * @param white_noise       standard deviation of the noise added to each measurement.
+ * @param bias_random_walk  rate the bias wanders at, in units/sqrt(s).
+ * @param initial_bias      standard deviation of the bias at the start of the run.
+ * @param quantization      resolution the measurement is rounded to, 0 for none.
+ * @param scale_factor      scale factor error on each axis, as a fraction.
+ * @param misalignment      small rotation of the sensor axes, in rad.
+ * @param attitude_noise    standard deviation of the rotation added to the attitude, in rad.
+ *                          Gyroscope only.
+ *
+**/
 typedef struct
 {
-    float omega;
-    float alpha;
-    float inertia;
-    Eigen::Vector3f axis_of_rotation;
-    Eigen::Vector3f position;
-} sim_reaction_wheel;
+    float           white_noise      = 0;
+    float           bias_random_walk = 0;
+    float           initial_bias     = 0;
+    float           quantization     = 0;
+    Eigen::Vector3f scale_factor     = Eigen::Vector3f::Zero();
+    Eigen::Vector3f misalignment     = Eigen::Vector3f::Zero();
+    float           attitude_noise   = 0;
+} sensor_noise;
 
 /**
  * @struct  sim_accelerometer
@@ -75,12 +260,14 @@ typedef struct
  * 
  * @param measurement latest "measured" value of the accelerometer.
  * @param position    the position of the satellite of the accelerometer.
+ * @param noise       error model of the measurements.
  * 
 **/
 typedef struct
 {
     Eigen::Vector3f measurement;
     Eigen::Vector3f position;
+    sensor_noise    noise;
 } sim_accelerometer;
 
 /**
@@ -90,6 +277,7 @@ typedef struct
  * 
  * @param measurement latest "measured" value of the gyroscope.
  * @param position    the position of the satellite of the gyroscope.
+ * @param noise       error model of the measured rate and attitude.
  * 
 **/
 typedef struct
@@ -98,8 +286,107 @@ typedef struct
     Eigen::Vector3f omega;
     Eigen::Vector3f alpha;
     Eigen::Vector3f position;
+    sensor_noise    noise;
 } sim_gyroscope;
 
+/**
+ * @struct  sim_magnetometer
+ *
+ * @details structure defining the status of a magnetometer in the simulator.
+ *
+ * @param enabled     whether the satellite has a magnetometer.
+ * @param measurement latest "measured" magnetic field in the body frame, in T.
+ * @param position    the position of the satellite of the magnetometer.
+ * @param noise       error model of the measurements.
+ *
+**/
+typedef struct
+{
+    bool            enabled     = false;
+    Eigen::Vector3f measurement = Eigen::Vector3f::Zero();
+    Eigen::Vector3f position    = Eigen::Vector3f::Zero();
+    sensor_noise    noise;
+} sim_magnetometer;
+
+/**
+ * @struct  sim_sun_sensor
+ *
+ * @details structure defining the status of a two dimensional sun sensor in the simulator.
+ *
+ * @param voltage       latest "measured" voltage of each diode, in V.
+ * @param name          the name of the sensor in the config, used to find it.
+ * @param position      the position of the sensor in the satellite.
+ * @param axis          unit vector diode 0 faces, in the body frame.
+ * @param perpendicular unit vector 90 degrees from the axis in the plane of the sensor.
+ * @param max_voltage   voltage of a diode facing the sun directly, in V.
+ * @param noise         error model of the direction of the sun the sensor sees.
+ *
+**/
+typedef struct
+{
+    Eigen::Vector4f voltage       = Eigen::Vector4f::Zero();
+    std::string     name;
+    Eigen::Vector3f position      = Eigen::Vector3f::Zero();
+    Eigen::Vector3f axis          = Eigen::Vector3f::UnitX();
+    Eigen::Vector3f perpendicular = Eigen::Vector3f::UnitY();
+    float           max_voltage   = 0;
+    sensor_noise    noise;
+} sim_sun_sensor;
+
+/**
+ * @struct  sim_orbit
+ *
+ * @details structure defining the orbit of the satellite in the simulator, propagated with SGP4.
+ *
+ * @param enabled       whether the orbit is modelled. The remaining values are unused if not.
+ * @param elements      the mean elements of the orbit.
+ * @param start_time    time since the epoch of the elements at the start of the simulation, in
+ *                      minutes.
+ * @param julian_date   the current Julian date (UTC).
+ * @param position      the current position of the satellite in the TEME frame, in km.
+ * @param velocity      the current velocity of the satellite in the TEME frame, in km/s.
+ *
+**/
+typedef struct
+{
+    bool            enabled     = false;
+    tle_elements    elements    = {};
+    double          start_time  = 0;
+    double          julian_date = 0;
+    Eigen::Vector3d position    = Eigen::Vector3d::Zero();
+    Eigen::Vector3d velocity    = Eigen::Vector3d::Zero();
+} sim_orbit;
+
+/**
+ * @struct  sim_disturbances
+ *
+ * @details structure defining the external disturbance torques modelled in the simulator. The
+ *          torques need the orbit, so none are modelled without one.
+ *
+ * @param update_period         time between samples of the environment along the orbit, in s.
+ * @param gravity_gradient      whether the gravity gradient torque is modelled.
+ * @param drag_area             area facing the atmosphere, in m^2. No drag is modelled if 0.
+ * @param drag_coefficient      drag coefficient of the satellite.
+ * @param drag_center           centre of pressure of the drag relative to the centre of mass, in m.
+ * @param solar_area            area facing the sun, in m^2. No solar pressure is modelled if 0.
+ * @param solar_reflectivity    fraction of the sunlight reflected back, from 0 to 1.
+ * @param solar_center          centre of pressure of the sunlight relative to the centre of mass, in m.
+ * @param residual_dipole       residual magnetic dipole of the satellite, in A*m^2. Not modelled if 0.
+ *
+**/
+typedef struct
+{
+    float           update_period      = 10;
+    bool            gravity_gradient   = false;
+    float           drag_area          = 0;
+    float           drag_coefficient   = 2.2f;
+    Eigen::Vector3f drag_center        = Eigen::Vector3f::Zero();
+    float           solar_area         = 0;
+    float           solar_reflectivity = 0;
+    Eigen::Vector3f solar_center       = Eigen::Vector3f::Zero();
+    Eigen::Vector3f residual_dipole    = Eigen::Vector3f::Zero();
+} sim_disturbances;
+
 /**
  * @struct  sim_config
  * 
@@ -108,7 +395,13 @@ typedef struct
  * @param satellite         info of the overall satellite
  * @param accelerometer     accelerometer info in the satellite system
  * @param gyroscope         gyroscope info in the satellite system
- * @param reaction_wheels   vector of all reaction wheels in the satellite system
+ * @param magnetometer      magnetometer info in the satellite system
+ * @param sun_sensors       all sun sensors in the satellite system
+ * @param reaction_wheels   all reaction wheels in the satellite system
+ * @param magnetorquers     all magnetorquers in the satellite system
+ * @param orbit             orbit of the satellite
+ * @param disturbances      external disturbance torques on the satellite
+ * @param noise_seed        seed of the sensor noise of the run
  * 
 **/
 typedef struct
@@ -116,7 +409,13 @@ typedef struct
     Satellite                        satellite;
     sim_accelerometer                accelerometer;
     sim_gyroscope                    gyroscope;
-    std::vector<sim_reaction_wheel>  reaction_wheels;
+    sim_magnetometer                 magnetometer;
+    std::vector<sim_sun_sensor>      sun_sensors;
+    sim_wheel_bank                   reaction_wheels;
+    sim_magnetorquer_bank            magnetorquers;
+    sim_orbit                        orbit;
+    sim_disturbances                 disturbances;
+    uint64_t                         noise_seed = 0;
 } sim_config;
 
 /**
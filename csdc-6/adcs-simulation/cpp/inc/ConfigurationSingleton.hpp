@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <array>
 #include <string>
 #include <unordered_map>
 
@@ -22,6 +23,7 @@
 /**
 * @name SensorConfig
 * @property type [SensorType], the sensor type
+* @property noise [sensor_noise], error model of the sensor, perfect unless a Noise block is given
 *
 * @details struct outlining the sensor configuration according to the input sensor
 * config and type
@@ -33,11 +35,22 @@ struct SensorConfig {
         for (const auto &n : node["Position"]) {
             position(j++) = n.as<float>();
         }
+        if (node["Noise"]) {
+            noise = LoadNoise(node["Noise"]);
+        }
     };
     virtual ~SensorConfig() = default;
     int pollingTime;
     SensorType type;
     Eigen::Vector3f position;
+    sensor_noise noise;
+
+    /**
+    * @name LoadNoise
+    * @param node [YAML::Node], the Noise block of a sensor
+    * @return the error model described by the block, missing keys are perfect
+    */
+    static sensor_noise LoadNoise(const YAML::Node &node);
 };
 
 /**
@@ -75,6 +88,36 @@ struct AccelerometerConfig : public SensorConfig
     AccelerometerConfig(const YAML::Node &node) : SensorConfig(SensorType::Accelerometer, node) {}
 };
 
+/**
+* @name MagnetometerConfig
+*
+* @details struct outling the configuration of a magnetometer according to the input YAML
+* parameters
+*/
+struct MagnetometerConfig : public SensorConfig
+{
+    MagnetometerConfig(const YAML::Node &node) : SensorConfig(SensorType::Magnetometer, node) {}
+};
+
+/**
+* @name SunSensorConfig
+* @property axis [Eigen::Vector3f], direction diode 0 faces, [1, 0, 0] if not specified
+* @property normal [Eigen::Vector3f], normal of the plane of the diodes, [0, 0, 1] if not specified
+* @property maxVoltage [float], voltage of a diode facing the sun directly, the calibrated value
+* if not specified
+*
+* @details struct outling the configuration of a two dimensional sun sensor according to the
+* input YAML parameters
+*/
+struct SunSensorConfig : public SensorConfig
+{
+    SunSensorConfig(const YAML::Node &node);
+
+    Eigen::Vector3f axis;
+    Eigen::Vector3f normal;
+    float maxVoltage;
+};
+
 /**
  * @name ReactionWheelConfig
  * @property momentOfInertia [Eigen::Matrix3f], matrix representing the moment of inertia
@@ -87,6 +130,9 @@ struct AccelerometerConfig : public SensorConfig
  * @property axisOfRotation [Eigen::Vector3f], axis of rotation of the reaction wheel
  * @property velocity [float], initial velocity of the reaction wheel
  * @property acceleration [float], initial acceleration of the reaction wheel
+ * @property motorTimeConstant [float], time constant of the motor in s, 0 if not specified
+ * @property coulombFriction [float], constant friction torque, 0 if not specified
+ * @property viscousFriction [float], friction torque per rad/s of wheel speed, 0 if not specified
  * 
  * @details struct outling the configuration of a reaction wheel according to the input YAML
 * parameters
@@ -104,17 +150,48 @@ struct ReactionWheelConfig : public ActuatorConfig {
     Eigen::Vector3f axisOfRotation;
     float velocity;
     float acceleration;
+    float motorTimeConstant;
+    float coulombFriction;
+    float viscousFriction;
 
 };
 
+/**
+ * @name MagnetorquerConfig
+ * @property maxDipole [float], largest magnetic dipole of the magnetorquer, in A*m^2
+ * @property pollingTime [float], polling time of the magnetorquer
+ * @property position [Eigen::Vector3f], position of the magnetorquer, used to identify it
+ * @property axis [Eigen::Vector3f], axis the magnetorquer produces its dipole along
+ *
+ * @details struct outling the configuration of a magnetorquer according to the input YAML
+* parameters
+*/
+struct MagnetorquerConfig : public ActuatorConfig {
+    MagnetorquerConfig(const YAML::Node &node);
+
+    float maxDipole;
+    float pollingTime;
+    Eigen::Vector3f position;
+    Eigen::Vector3f axis;
+};
+
 /**
  * @class Configuration
  *
- * @details class used in configuring the satellite based on its input YAML file
+ * @details class used in configuring the satellite based on its input YAML file. The interactive
+ * UI uses the shared instance from GetInstance. Independent runs, such as those of a campaign,
+ * create and copy their own instances. Copies share the sensor and actuator configs, so replace
+ * them with SetSensorConfig or SetActuatorConfig rather than modifying them.
  *
 **/
 class Configuration {
 public:
+    /**
+    * @name Configuration
+    * @details creates an empty configuration, filled in with Load and load_exit_file
+   **/
+    Configuration(){};
+
     /**
     * @name Load
     * @param fileName [string], the input YAML file's name
@@ -131,21 +208,11 @@ public:
    **/
     bool load_exit_file(const std::string &fileName);
 
-    /**
-    * @details copy constructor is explicitly deleted to prevent C++ from auto-generating one
-   **/
-    Configuration(const Configuration &) = delete;
-
-    /**
-    * @details equals operator is explicitly deleted to prevent C++ from auto-generating one
-   **/
-    void operator=(Configuration &) = delete;
-
     /**
     * @name GetInstance
     * @return instance of the satellite configuration
     *
-    * @details getter for an instance of the satellite's configuration
+    * @details getter for the instance of the satellite's configuration shared by the UI
    **/
     inline static Configuration &GetInstance() {
         static Configuration instance;
@@ -194,6 +261,28 @@ public:
         return actuatorConfigs;
     };
 
+    /**
+    * @name SetSensorConfig
+    * @param name [string], the name of the sensor
+    * @param sensor the new config of the sensor
+    *
+    * @details replaces the config of a sensor
+   **/
+    inline void SetSensorConfig(const std::string &name, const std::shared_ptr<SensorConfig> &sensor) {
+        sensorConfigs[name] = sensor;
+    };
+
+    /**
+    * @name SetActuatorConfig
+    * @param name [string], the name of the actuator
+    * @param actuator the new config of the actuator
+    *
+    * @details replaces the config of an actuator
+   **/
+    inline void SetActuatorConfig(const std::string &name, const std::shared_ptr<ActuatorConfig> &actuator) {
+        actuatorConfigs[name] = actuator;
+    };
+
     /**
     * @name GetSatelliteMoment
     * @return the Inertia matrix for the satellite
@@ -224,13 +313,33 @@ public:
         return satelliteVelocity;
     };
 
+    /**
+    * @name SetSatelliteMoment
+    * @param moment [Eigen::Matrix3f], the new inertia matrix of the satellite
+    *
+    * @details setter for the satellite's moment of inertia
+   **/
+    inline void SetSatelliteMoment(const Eigen::Matrix3f &moment) {
+        satelliteMomentOfInertia = moment;
+    };
+
+    /**
+    * @name SetSatelliteVelocity
+    * @param velocity [Eigen::Vector3f], the new initial velocity of the satellite
+    *
+    * @details setter for the satellite's initial velocity
+   **/
+    inline void SetSatelliteVelocity(const Eigen::Vector3f &velocity) {
+        satelliteVelocity = velocity;
+    };
+
     /**
     * @name GetTimestepInMilliSeconds
-    * @return the timestep, in seconds, as an int
+    * @return the timestep, in milliseconds, as a float
     * 
     * @details getter for the update timestep 
     */
-    inline const int &GetTimestepInMilliSeconds(){
+    inline const float &GetTimestepInMilliSeconds(){
         return timestepInMilliSeconds;
     }
 
@@ -264,6 +373,76 @@ public:
         return timeStepMin;
     }
 
+    /**
+    * @name    GetTimeMode
+    *
+    * @returns the time mode of the simulation, Virtual if it was not specified
+    */
+    inline const TimeMode &GetTimeMode()
+    {
+        return timeMode;
+    }
+
+    /**
+    * @name    GetControllerCostsInMilliseconds
+    *
+    * @returns the modelled cost of each control code call into the simulation, in ms. Indexed by
+    *          ControllerCall. Only used by the Virtual time mode.
+    */
+    inline const std::array<float, num_controller_calls> &GetControllerCostsInMilliseconds()
+    {
+        return controllerCostsInMilliseconds;
+    }
+
+    /**
+    * @name    GetIntegratorType
+    *
+    * @returns the integration method of the simulation, Euler if it was not specified
+    */
+    inline const IntegratorType &GetIntegratorType()
+    {
+        return integratorType;
+    }
+
+    /**
+    * @name    GetOrbit
+    *
+    * @returns the orbit of the satellite, disabled if it was not specified
+    */
+    inline const sim_orbit &GetOrbit()
+    {
+        return orbit;
+    }
+
+    /**
+    * @name    GetDisturbances
+    *
+    * @returns the disturbance torques on the satellite, none if they were not specified
+    */
+    inline const sim_disturbances &GetDisturbances()
+    {
+        return disturbances;
+    }
+
+    /**
+    * @name    GetNoiseSeed
+    *
+    * @returns the seed of the sensor noise, 0 if it was not specified
+    */
+    inline const uint64_t &GetNoiseSeed()
+    {
+        return noiseSeed;
+    }
+
+    /**
+    * @name    SetNoiseSeed
+    * @param seed the seed of the sensor noise
+    */
+    inline void SetNoiseSeed(uint64_t seed)
+    {
+        noiseSeed = seed;
+    }
+
     /**
     * @name    getTimeout
     * 
@@ -316,12 +495,25 @@ public:
         return required_hold_time;
     }
 
-private:
     /**
-    * @name Configuration
-    * @details hidden default constructor for the satellite configuration
-   **/
-    Configuration(){};
+    * @name    getControlMode
+    *
+    * @returns the mode the control code is run in, Pointing if it was not specified
+    */
+    inline const ControlMode &getControlMode()
+    {
+        return control_mode;
+    }
+
+    /**
+    * @name    getDetumbleRate
+    *
+    * @returns the rate the satellite counts as detumbled below, in rad/s
+    */
+    inline const float &getDetumbleRate()
+    {
+        return detumble_rate;
+    }
 
 private:
     
@@ -358,13 +550,43 @@ private:
     /**
      * @details float storing the timestep in milliseconds
     */
-    int timestepInMilliSeconds;
+    float timestepInMilliSeconds = 0;
 
     /**
      * @details int storing the timeout in milliseconds
     */
     int timeoutInMilliseconds;
 
+    /**
+     * @details how the run time of the control code is accounted for
+    */
+    TimeMode timeMode = TimeMode::Virtual;
+
+    /**
+     * @details modelled cost of each control code call in ms, indexed by ControllerCall
+    */
+    std::array<float, num_controller_calls> controllerCostsInMilliseconds = {};
+
+    /**
+     * @details numerical integration method used to propagate the simulation
+    */
+    IntegratorType integratorType = IntegratorType::Euler;
+
+    /**
+     * @details orbit of the satellite, from the TLE of the Orbit block
+    */
+    sim_orbit orbit;
+
+    /**
+     * @details disturbance torques on the satellite, from the Disturbances block
+    */
+    sim_disturbances disturbances;
+
+    /**
+     * @details seed of the sensor noise
+    */
+    uint64_t noiseSeed = 0;
+
     /**
      * @details bool storing whether or not to use variable timestep
     */
@@ -392,4 +614,10 @@ private:
     /* the amount of time the controller needs to hold the target, in ms */
     int required_hold_time;
 
+    /* the mode the control code is run in */
+    ControlMode control_mode = ControlMode::Pointing;
+
+    /* the rate the satellite counts as detumbled below, in rad/s */
+    float detumble_rate = 0.01f;
+
 };
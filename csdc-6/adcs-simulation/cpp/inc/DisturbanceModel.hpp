@@ -0,0 +1,238 @@
+/**
+ * @file    DisturbanceModel.hpp
+ *
+ * @details Header file for the external disturbance torques on the satellite. The environment the
+ *          torques depend on is sampled along the orbit at a lower rate than the integrator and
+ *          interpolated, and only the cheap attitude dependent part of each model is evaluated
+ *          every timestep.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <Eigen/Dense>
+#include <Eigen/Geometry>
+
+#include "def_interface.hpp"
+#include "CommonStructs.hpp"
+#include "MagneticField.hpp"
+#include "SGP4.hpp"
+
+/**
+ * @struct  environment_sample
+ *
+ * @details the environment of the satellite at one time, in the inertial frame.
+ *
+ * @param position          position of the satellite, in km.
+ * @param air_velocity      velocity of the satellite relative to the atmosphere, in m/s.
+ * @param sun_direction     unit vector from the satellite to the sun.
+ * @param sunlight          1 in sunlight, 0 in the shadow of the earth.
+ * @param magnetic_field    the earth's magnetic field, in T.
+ * @param density           density of the atmosphere, in kg/m^3.
+**/
+typedef struct
+{
+    Eigen::Vector3f position;
+    Eigen::Vector3f air_velocity;
+    Eigen::Vector3f sun_direction;
+    float           sunlight;
+    Eigen::Vector3f magnetic_field;
+    float           density;
+} environment_sample;
+
+/**
+ * @class DisturbanceModel
+ *
+ * @details abstract base class for a single source of disturbance torque.
+ *
+ * @note    THIS IS AN ENTIRELY ABSTRACT CLASS.
+**/
+class DisturbanceModel
+{
+    public:
+        /**
+         * @name DisturbanceModel destructor
+         *
+         * @details virtual as this class is a base class with virtual functions.
+        **/
+        virtual ~DisturbanceModel(){}
+
+        /**
+         * @name    torque
+         *
+         * @param   environment the environment of the satellite, in the inertial frame.
+         * @param   attitude    rotation from the body frame to the inertial frame.
+         * @param   inertia     inertia tensor of the satellite body.
+         *
+         * @returns the disturbance torque in the body frame, in N*m.
+        **/
+        virtual Eigen::Vector3f torque(const environment_sample &environment, const Eigen::Quaternionf &attitude,
+                                       const Eigen::Matrix3f &inertia) const = 0;
+};
+
+/**
+ * @class GravityGradientModel
+ *
+ * @details torque from the difference in gravity across an asymmetric satellite.
+**/
+class GravityGradientModel : public DisturbanceModel
+{
+    public:
+        Eigen::Vector3f torque(const environment_sample &environment, const Eigen::Quaternionf &attitude,
+                               const Eigen::Matrix3f &inertia) const override;
+};
+
+/**
+ * @class AerodynamicModel
+ *
+ * @details torque from atmospheric drag acting at a centre of pressure offset from the centre of
+ *          mass. The area facing the flow is treated as constant.
+**/
+class AerodynamicModel : public DisturbanceModel
+{
+    public:
+        /**
+         * @name    AerodynamicModel constructor
+         *
+         * @param   area              area facing the flow, in m^2.
+         * @param   drag_coefficient  drag coefficient.
+         * @param   center            centre of pressure relative to the centre of mass, in m.
+        **/
+        AerodynamicModel(float area, float drag_coefficient, const Eigen::Vector3f &center);
+
+        Eigen::Vector3f torque(const environment_sample &environment, const Eigen::Quaternionf &attitude,
+                               const Eigen::Matrix3f &inertia) const override;
+
+    private:
+        /* half the drag coefficient times the area, so the force is this times density * v^2 */
+        float drag_area;
+
+        /* centre of pressure relative to the centre of mass */
+        Eigen::Vector3f center;
+};
+
+/**
+ * @class SolarPressureModel
+ *
+ * @details torque from solar radiation pressure acting at a centre of pressure offset from the
+ *          centre of mass. The area facing the sun is treated as constant.
+**/
+class SolarPressureModel : public DisturbanceModel
+{
+    public:
+        /**
+         * @name    SolarPressureModel constructor
+         *
+         * @param   area          area facing the sun, in m^2.
+         * @param   reflectivity  fraction of the light reflected back, from 0 to 1.
+         * @param   center        centre of pressure relative to the centre of mass, in m.
+        **/
+        SolarPressureModel(float area, float reflectivity, const Eigen::Vector3f &center);
+
+        Eigen::Vector3f torque(const environment_sample &environment, const Eigen::Quaternionf &attitude,
+                               const Eigen::Matrix3f &inertia) const override;
+
+    private:
+        /* force of the sunlight on the satellite, in N */
+        float force;
+
+        /* centre of pressure relative to the centre of mass */
+        Eigen::Vector3f center;
+};
+
+/**
+ * @class ResidualDipoleModel
+ *
+ * @details torque from the residual magnetic dipole of the satellite in the earth's magnetic field.
+**/
+class ResidualDipoleModel : public DisturbanceModel
+{
+    public:
+        /**
+         * @name    ResidualDipoleModel constructor
+         *
+         * @param   dipole the residual dipole of the satellite in the body frame, in A*m^2.
+        **/
+        ResidualDipoleModel(const Eigen::Vector3f &dipole);
+
+        Eigen::Vector3f torque(const environment_sample &environment, const Eigen::Quaternionf &attitude,
+                               const Eigen::Matrix3f &inertia) const override;
+
+    private:
+        /* residual dipole in the body frame */
+        Eigen::Vector3f dipole;
+};
+
+/**
+ * @class DisturbanceTorques
+ *
+ * @details sums the configured disturbance models. The environment is sampled along the orbit
+ *          every update period, one period ahead since the orbit is known in advance, and linearly
+ *          interpolated between the samples for each timestep.
+**/
+class DisturbanceTorques
+{
+    public:
+        /**
+         * @name    DisturbanceTorques constructor
+         *
+         * @param   config the disturbance models to use.
+         * @param   orbit  the orbit of the satellite, and its propagator.
+        **/
+        DisturbanceTorques(const sim_disturbances &config, const sim_orbit &orbit);
+
+        /**
+         * @name    torque
+         *
+         * @param   time        the simulation time.
+         * @param   attitude    rotation from the body frame to the inertial frame.
+         * @param   inertia     inertia tensor of the satellite body.
+         *
+         * @returns the sum of the disturbance torques in the body frame, in N*m.
+        **/
+        Eigen::Vector3f torque(timestamp time, const Eigen::Quaternionf &attitude, const Eigen::Matrix3f &inertia);
+
+        /**
+         * @name    num_models
+         *
+         * @returns the number of disturbance models in use.
+        **/
+        inline size_t num_models() const { return this->models.size(); }
+
+    private:
+        /**
+         * @name    sample
+         *
+         * @param   time the simulation time to sample the environment at.
+         *
+         * @returns the environment of the satellite at the time.
+        **/
+        environment_sample sample(timestamp time);
+
+        /* the disturbance models */
+        std::vector<std::unique_ptr<DisturbanceModel>> models;
+
+        /* propagator of the orbit */
+        SGP4 orbit_model;
+
+        /* model of the earth's magnetic field */
+        MagneticField magnetic_field;
+
+        /* time since the epoch of the orbit at the start of the simulation, in minutes */
+        double start_time;
+
+        /* time between samples of the environment */
+        timestamp update_period;
+
+        /* the samples the current time is between, and their times */
+        environment_sample previous;
+        environment_sample next;
+        timestamp          previous_time;
+        timestamp          next_time;
+        bool               sampled = false;
+};
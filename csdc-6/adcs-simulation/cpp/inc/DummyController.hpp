@@ -38,7 +38,8 @@ public:
     /**
      * @name begin
      *
-     * @details Starts the command loop. Should calls the timer once per loop to update time sim.
+     * @details Starts the command loop. Sleeps until the timeout, so the simulation is advanced in
+     *          as few calls as possible.
      *
      * @param desired_attitue [vector<float>], the desired angle to point at
      *
@@ -0,0 +1,169 @@
+/**
+ * @file    DynamicsModel.hpp
+ *
+ * @details Header file for the rotational dynamics of the satellite. Holds every value of the model
+ *          that is constant for a simulation run so it is not recalculated each timestep.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <vector>
+#include <Eigen/Dense>
+#include <Eigen/Geometry>
+
+#include "CommonStructs.hpp"
+
+/**
+ * @class DynamicsModel
+ *
+ * @details rotational dynamics of the satellite body and its reaction wheels. The packed state
+ *          used by the integrator is the satellite angular velocity, the rotation of the satellite
+ *          since the start of the timestep, the angular velocity of each reaction wheel, then the
+ *          angular acceleration driven by the motor of each reaction wheel.
+ *
+ *          The motor drive follows the commanded acceleration with a first order lag, and stops
+ *          driving the wheel faster as it reaches its maximum speed. Coulomb and viscous friction
+ *          act against the spin of the wheel, and the torque of the wheel on the satellite is that
+ *          of its acceleration after friction. The parameters of the wheels are kept as one array
+ *          per parameter like the wheel bank of the simulator, so all the wheels are updated together.
+ *
+ *          The rotation is a rotation vector that starts each timestep at zero and is applied to
+ *          the attitude quaternion with the exponential map once the step is done. Its derivative
+ *          includes the inverse of the differential of the exponential map, so the attitude stays
+ *          on SO(3) and is accurate for large rotations within a single step.
+**/
+class DynamicsModel
+{
+    public:
+        /**
+         * @name    DynamicsModel constructor
+         *
+         * @details creates an empty model with no reaction wheels.
+        **/
+        DynamicsModel() = default;
+
+        /**
+         * @name    DynamicsModel constructor
+         *
+         * @details precomputes the invariants of the satellite system.
+         *
+         * @param   system the satellite system at the start of the simulation.
+        **/
+        DynamicsModel(const sim_config &system);
+
+        /**
+         * @name    set_wheel_commands
+         *
+         * @details updates the model with the commanded angular acceleration of each reaction
+         *          wheel. Must be called every time a wheel is commanded.
+         *
+         * @param   reaction_wheels all reaction wheels, in the same order as the constructor.
+        **/
+        void set_wheel_commands(const sim_wheel_bank &reaction_wheels);
+
+        /**
+         * @name    set_wheel_command
+         *
+         * @details as above, for a single reaction wheel.
+         *
+         * @param   index   index of the reaction wheel, in the same order as the constructor.
+         * @param   command the new commanded angular acceleration of the reaction wheel.
+        **/
+        void set_wheel_command(uint32_t index, float command);
+
+        /**
+         * @name    set_external_torque
+         *
+         * @details updates the model with the external torque on the satellite, such as the
+         *          environmental disturbances. It is held constant until it is next set.
+         *
+         * @param   torque the external torque in the body frame, in N*m.
+        **/
+        void set_external_torque(const Eigen::Vector3f &torque);
+
+        /**
+         * @name    calculate_derivative
+         *
+         * @details calculates the time derivative of the packed state.
+         *
+         * @param   state       the packed state.
+         * @param   derivative  filled with the time derivative of the state.
+        **/
+        void calculate_derivative(const Eigen::VectorXf &state, Eigen::VectorXf &derivative) const;
+
+        /**
+         * @name    state_size
+         *
+         * @returns the size of the packed state.
+        **/
+        Eigen::Index state_size() const { return 6 + 2 * this->wheel_command.size(); }
+
+        /**
+         * @name    exp
+         *
+         * @param   rotation a rotation vector, the axis of rotation times the angle in radians.
+         *
+         * @returns the unit quaternion of the rotation.
+        **/
+        static Eigen::Quaternionf exp(const Eigen::Vector3f &rotation);
+
+        /**
+         * @name    log
+         *
+         * @param   attitude a unit quaternion.
+         *
+         * @returns the rotation vector of the quaternion, with an angle in [0, pi].
+        **/
+        static Eigen::Vector3f log(const Eigen::Quaternionf &attitude);
+
+    private:
+        /**
+         * @name    dexp_inverse
+         *
+         * @details rate of change of the rotation vector for a given body angular velocity.
+         *
+         * @param   rotation the rotation vector since the start of the timestep.
+         * @param   omega    the angular velocity of the satellite body.
+         *
+         * @returns the derivative of the rotation vector.
+        **/
+        static Eigen::Vector3f dexp_inverse(const Eigen::Vector3f &rotation, const Eigen::Vector3f &omega);
+
+    private:
+        /* inertia tensor of the satellite body */
+        Eigen::Matrix3f inertia_b = Eigen::Matrix3f::Identity();
+
+        /* inverse of the inertia tensor of the satellite body */
+        Eigen::Matrix3f inertia_b_inverse = Eigen::Matrix3f::Identity();
+
+        /* axis of rotation of each reaction wheel scaled by its inertia, one column per wheel */
+        Eigen::Matrix3Xf wheel_axes;
+
+        /* external torque on the satellite body */
+        Eigen::Vector3f external_torque = Eigen::Vector3f::Zero();
+
+        /* commanded angular acceleration of each reaction wheel */
+        Eigen::ArrayXf wheel_command;
+
+        /* speed each motor stops driving its reaction wheel faster at */
+        Eigen::ArrayXf wheel_max_omega;
+
+        /* inverse of the time constant of each motor, 0 for motors that respond instantly */
+        Eigen::ArrayXf wheel_motor_rate;
+
+        /* coulomb friction of each reaction wheel, as an angular acceleration */
+        Eigen::ArrayXf wheel_coulomb;
+
+        /* viscous friction of each reaction wheel, as an angular acceleration per unit of speed */
+        Eigen::ArrayXf wheel_viscous;
+
+        /* coulomb friction is smoothed over this speed, so it is continuous when a wheel reverses */
+        static constexpr float coulomb_speed_band = 0.1f;
+
+        /* the drive tapers off over this speed below the maximum, so the wheel settles at its limit */
+        static constexpr float saturation_speed_band = 1.0f;
+};
@@ -0,0 +1,82 @@
+/**
+ * @file    Environment.hpp
+ *
+ * @details Header file for the models of the space environment around the satellite: the
+ *          position of the sun, the earth's shadow, the density of the atmosphere and the earth's
+ *          magnetic field. All positions are in the inertial (TEME) frame of the orbit, in km.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <Eigen/Dense>
+
+/**
+ * @class   Environment
+ *
+ * @details low fidelity environment models, accurate enough for attitude disturbances and sensor
+ *          simulation. Every function only depends on its arguments.
+**/
+class Environment
+{
+    public:
+        /**
+         * @name    gmst
+         *
+         * @param   julian_date the Julian date (UT1, UTC is close enough).
+         *
+         * @returns the Greenwich mean sidereal time, the angle between the inertial and earth fixed
+         *          frames, in rad.
+        **/
+        static double gmst(double julian_date);
+
+        /**
+         * @name    sun_position
+         *
+         * @param   julian_date the Julian date.
+         *
+         * @returns the position of the sun relative to the earth, in km. Accurate to about 0.01
+         *          degrees.
+        **/
+        static Eigen::Vector3d sun_position(double julian_date);
+
+        /**
+         * @name    in_shadow
+         *
+         * @param   position the position of the satellite, in km.
+         * @param   sun      the position of the sun, in km.
+         *
+         * @returns true if the satellite is in the shadow of the earth, modelled as a cylinder.
+        **/
+        static bool in_shadow(const Eigen::Vector3d &position, const Eigen::Vector3d &sun);
+
+        /**
+         * @name    atmosphere_density
+         *
+         * @param   position the position of the satellite, in km.
+         *
+         * @returns the density of the atmosphere from an exponential model, in kg/m^3.
+        **/
+        static double atmosphere_density(const Eigen::Vector3d &position);
+
+        /**
+         * @name    atmosphere_velocity
+         *
+         * @param   position the position of the satellite, in km.
+         * @param   velocity the inertial velocity of the satellite, in km/s.
+         *
+         * @returns the velocity of the satellite relative to the atmosphere, which rotates with the
+         *          earth, in km/s.
+        **/
+        static Eigen::Vector3d atmosphere_velocity(const Eigen::Vector3d &position, const Eigen::Vector3d &velocity);
+
+        /* constants of the models */
+        static constexpr double earth_radius       = 6378.137;          // km
+        static constexpr double earth_mu           = 398600.4418;       // km^3/s^2
+        static constexpr double earth_rotation     = 7.292115e-5;       // rad/s
+        static constexpr double astronomical_unit  = 149597870.7;       // km
+        static constexpr double solar_pressure     = 4.56e-6;           // N/m^2, at 1 AU
+};
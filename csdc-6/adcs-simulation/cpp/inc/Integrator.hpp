@@ -0,0 +1,207 @@
+/**
+ * @file    Integrator.hpp
+ *
+ * @details Header file for the numerical integrators used to propagate the simulation state. All
+ *          integrators operate on a flat state vector, and the system is described by a function
+ *          that calculates the derivative of that vector.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <Eigen/Dense>
+
+#include "CommonStructs.hpp"
+#include "adcs_exception.hpp"
+
+/**
+ * @class Integrator
+ *
+ * @details abstract base class for all integrators. Integrators keep their intermediate stage
+ *          vectors between steps so no memory is allocated once the state size is fixed.
+ *
+ * @note    THIS IS AN ENTIRELY ABSTRACT CLASS.
+**/
+class Integrator
+{
+    public:
+        /**
+         * @typedef derivative_function
+         *
+         * @details function describing the system. The first parameter is the state, the second
+         *          is filled with the time derivative of the state.
+        **/
+        using derivative_function = std::function<void(const Eigen::VectorXf &, Eigen::VectorXf &)>;
+
+        /**
+         * @name Integrator destructor
+         *
+         * @details virtual as this class is a base class with virtual functions.
+        **/
+        virtual ~Integrator(){}
+
+        /**
+         * @name    create
+         *
+         * @details creates an integrator of the requested type.
+         *
+         * @param   type the integration method.
+         *
+         * @returns the new integrator.
+        **/
+        static std::unique_ptr<Integrator> create(IntegratorType type);
+
+        /**
+         * @name    step
+         *
+         * @details advances the state by one step.
+         *
+         * @param   derivative  function describing the system.
+         * @param   state       state to advance. Updated in place.
+         * @param   dt          length of the step in seconds.
+         *
+         * @returns the estimated local error of the step for each element of the state. Only valid
+         *          if has_error_estimate() is true, otherwise it is all zeros.
+        **/
+        virtual const Eigen::VectorXf &step(const derivative_function &derivative, Eigen::VectorXf &state, float dt) = 0;
+
+        /**
+         * @name    has_error_estimate
+         *
+         * @returns true if the integrator estimates the local error of each step.
+        **/
+        virtual bool has_error_estimate() const { return false; }
+
+        /**
+         * @name    order
+         *
+         * @returns the order of accuracy of the integrator. Used for step size control.
+        **/
+        virtual int order() const = 0;
+
+        /**
+         * @name    start_derivative
+         *
+         * @returns the derivative of the state at the start of the last step.
+        **/
+        const Eigen::VectorXf &start_derivative() const { return k1; }
+
+        /**
+         * @name    set_kinematic_states
+         *
+         * @details marks the elements of the state that are integrals of other elements, like the
+         *          attitude of the satellite is of its rate. Only used by semi-implicit methods.
+         *
+         * @param   start   index of the first kinematic element.
+         * @param   size    number of kinematic elements.
+        **/
+        void set_kinematic_states(Eigen::Index start, Eigen::Index size)
+        {
+            this->kinematic_start = start;
+            this->kinematic_size  = size;
+        }
+
+    protected:
+        /**
+         * @name    resize
+         *
+         * @details resizes the stage vectors if the state size has changed.
+         *
+         * @param   size the size of the state vector.
+        **/
+        virtual void resize(Eigen::Index size);
+
+        /* derivative at the start of the step */
+        Eigen::VectorXf k1;
+
+        /* local error estimate of the last step */
+        Eigen::VectorXf error;
+
+        /* elements of the state that are integrals of other elements */
+        Eigen::Index kinematic_start = 0;
+        Eigen::Index kinematic_size  = 0;
+};
+
+/**
+ * @class EulerIntegrator
+ *
+ * @details first order semi-implicit Euler method. The kinematic elements of the state are
+ *          advanced with the rates at the end of the step, so an attitude oscillating under a
+ *          restoring torque, like the gravity gradient, does not gain energy every step as it does
+ *          with explicit Euler. Without kinematic elements this is explicit Euler.
+ *
+ * @implements Integrator
+**/
+class EulerIntegrator : public Integrator
+{
+    public:
+        const Eigen::VectorXf &step(const derivative_function &derivative, Eigen::VectorXf &state, float dt) override;
+        int order() const override { return 1; }
+
+    protected:
+        void resize(Eigen::Index size) override;
+
+    private:
+        /* derivative at the end of the step and the intermediate state */
+        Eigen::VectorXf k2, stage;
+};
+
+/**
+ * @class RK4Integrator
+ *
+ * @details classic fourth order Runge-Kutta method.
+ *
+ * @implements Integrator
+**/
+class RK4Integrator : public Integrator
+{
+    public:
+        const Eigen::VectorXf &step(const derivative_function &derivative, Eigen::VectorXf &state, float dt) override;
+        int order() const override { return 4; }
+
+    protected:
+        void resize(Eigen::Index size) override;
+
+    private:
+        /* stage derivatives and the intermediate state */
+        Eigen::VectorXf k2, k3, k4, stage;
+};
+
+/**
+ * @class RK45Integrator
+ *
+ * @details Dormand-Prince 5(4) method. The state is advanced with the fifth order solution and the
+ *          difference to the embedded fourth order solution is used as the local error estimate.
+ *
+ * @implements Integrator
+**/
+class RK45Integrator : public Integrator
+{
+    public:
+        const Eigen::VectorXf &step(const derivative_function &derivative, Eigen::VectorXf &state, float dt) override;
+        bool has_error_estimate() const override { return true; }
+        int order() const override { return 5; }
+
+    protected:
+        void resize(Eigen::Index size) override;
+
+    private:
+        /* stage derivatives and the intermediate state */
+        Eigen::VectorXf k2, k3, k4, k5, k6, k7, stage;
+};
+
+/**
+ * @exception invalid_integrator
+ *
+ * @details exception used to indicate that an unknown integrator was requested.
+**/
+class invalid_integrator : public adcs_exception
+{
+    public:
+        invalid_integrator(const char* msg) :  adcs_exception(msg) {}
+};
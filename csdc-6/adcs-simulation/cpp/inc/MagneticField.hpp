@@ -0,0 +1,100 @@
+/**
+ * @file    MagneticField.hpp
+ *
+ * @details Header file for the model of the earth's magnetic field, a spherical harmonic expansion
+ *          with the IGRF-13 coefficients.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <Eigen/Dense>
+
+/**
+ * @class   MagneticField
+ *
+ * @details the International Geomagnetic Reference Field, truncated to degree 8, which is within
+ *          about 100 nT of the full model in low earth orbit. Degree 1 is the tilted dipole.
+ *
+ *          The coefficients are converted once to the form the Legendre recursion uses, and the
+ *          secular variation is only applied again once the date has moved by a day, so each
+ *          evaluation is a single pass of the recursion with no trigonometry beyond the position.
+ *          The last evaluation is also kept, as the same position is often queried more than once.
+ *          Every model owns its own work space, so models in different simulations can be used at
+ *          the same time.
+**/
+class MagneticField
+{
+    public:
+        /* highest degree of the expansion that is tabulated */
+        static constexpr uint32_t max_degree = 8;
+
+        /**
+         * @name    MagneticField constructor
+         *
+         * @param   degree the degree to truncate the expansion to, limited to 1 to max_degree.
+        **/
+        MagneticField(uint32_t degree = max_degree);
+
+        /**
+         * @name    field
+         *
+         * @param   position    the position of the satellite in the inertial (TEME) frame, in km.
+         * @param   julian_date the Julian date (UTC).
+         *
+         * @returns the earth's magnetic field in the inertial frame, in T.
+        **/
+        Eigen::Vector3d field(const Eigen::Vector3d &position, double julian_date);
+
+        /**
+         * @name    get_degree
+         *
+         * @returns the degree the expansion is truncated to.
+        **/
+        inline uint32_t get_degree() const { return this->degree; }
+
+        /* reference radius of the IGRF, in km */
+        static constexpr double reference_radius = 6371.2;
+
+        /* number of coefficients of each kind up to max_degree, indexed by n * (n + 1) / 2 + m */
+        static constexpr size_t table_size = (max_degree + 1) * (max_degree + 2) / 2;
+
+    private:
+        /**
+         * @name    update_coefficients
+         *
+         * @details applies the secular variation to the coefficients for a date, and scales them by
+         *          the Schmidt normalisation factors.
+         *
+         * @param   julian_date the Julian date to find the coefficients at.
+        **/
+        void update_coefficients(double julian_date);
+
+        /* degree the expansion is truncated to */
+        uint32_t degree;
+
+        /* Schmidt normalisation factor of each coefficient */
+        std::array<double, table_size> schmidt;
+
+        /* recursion constant of the Legendre function of each coefficient */
+        std::array<double, table_size> recursion;
+
+        /* coefficients at coefficient_date with the normalisation applied, in nT */
+        std::array<double, table_size> g;
+        std::array<double, table_size> h;
+        double coefficient_date = 0;
+
+        /* work space of the Legendre functions and their derivatives */
+        std::array<double, table_size> legendre;
+        std::array<double, table_size> legendre_derivative;
+
+        /* the last evaluation of the model */
+        Eigen::Vector3d last_position = Eigen::Vector3d::Zero();
+        double          last_date     = 0;
+        Eigen::Vector3d last_field    = Eigen::Vector3d::Zero();
+};
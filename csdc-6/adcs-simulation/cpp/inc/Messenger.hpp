@@ -15,11 +15,31 @@
 
 #include <string>
 #include <iostream>
+#include <chrono>
 #include <fstream>
+#include <memory>
+#include <vector>
 
 #include "CommonStructs.hpp"
+#include "OutputWriter.hpp"
+#include "RowFormatter.hpp"
 #include "def_interface.hpp"
 
+/**
+ * @enum    OutputFormat
+ *
+ * @details format of the simulation output file.
+ *
+ * @param CSV       text csv file, one row per output.
+ * @param Binary    fixed width binary records, as described in TelemetryFormat.hpp. Much faster
+ *                  to write and read for long runs.
+**/
+enum class OutputFormat
+{
+    CSV,
+    Binary
+};
+
 /**
  * @class   Messenger
  *
@@ -29,6 +49,13 @@
 class Messenger
 {
     public:
+        /**
+         * @name Messenger destructor
+         *
+         * @details virtual as the simulation state updates may be overridden.
+        **/
+        virtual ~Messenger(){}
+
         /**
          * @name    send_message
          *
@@ -71,10 +98,11 @@ class Messenger
          *          be added.
          *
          * @param state state variables of the satellite, including angular position, velocity, and
-         *              acceleration.
+         *              acceleration. Only read if a print is due, and never copied, as this is
+         *              called every timestep.
          * @param time  time of the update.
         **/
-        void update_simulation_state(sim_config state, timestamp time, timestamp timestep);
+        virtual void update_simulation_state(const sim_config &state, timestamp time, timestamp timestep);
 
         /**
          * @name    prompt_char
@@ -90,7 +118,8 @@ class Messenger
          * @name    start_new_sim
          *
          * @details prints a header with columns for each simulation property, and starts a csv
-         *          file with the same header information.
+         *          file with the same header information. The output file is named here and
+         *          written to as the simulation runs.
          * 
          * @param num_reaction_wheels number of reaction wheels in the run, used for the header.
         **/
@@ -135,6 +164,25 @@ class Messenger
         **/
         void set_terminal_print_rate(uint32_t terminal_rate);
 
+        /**
+         * @name    set_output_format
+         *
+         * @details sets the format of the output file. Must be set before the simulation starts.
+         *
+         * @param   format the format of the output file.
+        **/
+        void set_output_format(OutputFormat format);
+
+        /**
+         * @name    set_output_precision
+         *
+         * @details sets the number of significant digits of the floats in the csv and terminal
+         *          outputs. The binary output is always exact.
+         *
+         * @param   precision number of significant digits, from 1 to 9.
+        **/
+        void set_output_precision(int precision);
+
 
         /**
         * @name get_output_file_path_string
@@ -165,6 +213,33 @@ class Messenger
             return default_csv_path;
         }
 
+        /**
+         * @name    get_new_output_file
+         *
+         * @details finds an unused csv file name in the output directory, creating the directory
+         *          if needed. A number is appended to the name if the file already exists.
+         *
+         * @param   name the name of the file, without the directory or extension.
+         *
+         * @returns the path to the new csv file.
+        **/
+        inline std::string get_new_output_file(const std::string &name)
+        {
+            return get_new_output_file(name, csv_ext);
+        }
+
+        /**
+         * @name    get_new_output_file
+         *
+         * @details as above, for a file with the given extension.
+         *
+         * @param   name        the name of the file, without the directory or extension.
+         * @param   extension   the extension of the file, including the dot.
+         *
+         * @returns the path to the new file.
+        **/
+        std::string get_new_output_file(const std::string &name, const std::string &extension);
+
         /**
          * @name    silence_csv
          *
@@ -173,11 +248,20 @@ class Messenger
         void silence_csv();
 
         /**
-         * @name    write_output_buffer
+         * @name    silence_all
+         *
+         * @details silences all terminal prints and csv outputs, including messages and warnings.
+         *          Errors are still printed. Used when many simulations run at once.
+        **/
+        void silence_all();
+
+        /**
+         * @name    close_output_file
          * 
-         * @details saves the file buffer to a new csv file
+         * @details writes out the rest of the output and closes the output file. Does nothing if
+         *          there is no output file open.
         */
-        void write_output_buffer();
+        void close_output_file();
 
     private:
         /**
@@ -190,29 +274,67 @@ class Messenger
         **/
         void write_cout_header(uint32_t num_reaction_wheels);
 
+        /**
+         * @name    open_output_file
+         *
+         * @details opens a new csv or binary output file, depending on the output format, and
+         *          writes its header.
+        **/
+        void open_output_file();
+
         /**
          * @name    write_csv_header
          * 
-         * @details writes a header to the csv file for the simulation run
-         * 
-         * @param   num_reaction_wheels the number of reaction wheels used. This is necessary for
-         *                              the number of columns to print.
+         * @details writes the column header to the csv output file.
         **/
-        void write_csv_header(uint32_t num_reaction_wheels);
+        void write_csv_header();
+
+        /**
+         * @name    write_binary_header
+         *
+         * @details writes the binary telemetry header to the binary output file.
+        **/
+        void write_binary_header();
+
+        /**
+         * @name    set_output_columns
+         *
+         * @details sets the names of the output columns, shared by the csv and binary outputs,
+         *          and sizes the output record to match.
+         *
+         * @param   num_reaction_wheels the number of reaction wheels used.
+        **/
+        void set_output_columns(uint32_t num_reaction_wheels);
+
+        /**
+         * @name    fill_output_record
+         *
+         * @details fills the output record with a simulation state, in the order of the output
+         *          columns.
+        **/
+        void fill_output_record(const sim_config &state, timestamp time, timestamp timestep);
 
         /**
          * @name    append_csv_output
          *
-         * @details appends a simulation state to the csv output buffer.
+         * @details appends a simulation state to the csv or binary output file.
         **/
-        void append_csv_output(sim_config state, timestamp time, timestamp timestep);
+        void append_csv_output(const sim_config &state, timestamp time, timestamp timestep);
 
         /**
          * @name    append_cout_output
          * 
-         * @details appends a simulation state to the terminal.
+         * @details appends a simulation state to the terminal. The terminal is only flushed once
+         *          every terminal_flush_period, and by the messages at the end of the run.
         **/
-        void append_cout_output(sim_config state, timestamp time, timestamp timestep);
+        void append_cout_output(const sim_config &state, timestamp time, timestamp timestep);
+
+        /**
+         * @name    append_vector
+         *
+         * @details appends the three values of a vector to the terminal row, separated by commas.
+        **/
+        void append_vector(const Eigen::Vector3f &vector);
 
     private:
         /* Character used to denote user control of the terminal.**/
@@ -227,12 +349,21 @@ class Messenger
         /* extension of csv files */
         const std::string csv_ext = ".csv";
 
+        /* default format of the output file */
+        const OutputFormat default_output_format = OutputFormat::CSV;
+
         /* default state of the terminal prints */
         const bool default_silent_sim_prints = false;
 
         /* default state of the csv prints */
         const bool default_silent_csv_prints = false;
 
+        /* wall clock time between flushes of the terminal during a simulation */
+        const std::chrono::milliseconds terminal_flush_period = std::chrono::milliseconds(100);
+
+        /* true to write the output file on a background thread */
+        const bool background_output = true;
+
         /* default print rate to the csv file in ms */
         const timestamp default_csv_print_rate = timestamp(1,0);
 
@@ -248,6 +379,9 @@ class Messenger
         /* state of the terminal prints */
         bool silent_csv_prints = false;
 
+        /* state of the messages and warnings */
+        bool silent_messages = false;
+
         /* print rate to the csv file in ms */
         timestamp csv_print_rate = timestamp(1,0);
 
@@ -260,8 +394,32 @@ class Messenger
         /* Previous time the terminal was updated */
         timestamp previous_terminal_write = 0;
 
-        /* Buffer variable for the simulation output data. */
-        std::stringstream output_file_buffer;
+        /* format of the output file */
+        OutputFormat output_format = OutputFormat::CSV;
+
+        /* number of reaction wheels in the current run */
+        uint32_t num_reaction_wheels = 0;
+
+        /* names of the output columns */
+        std::vector<std::string> output_columns;
+
+        /* the latest output row, one value per output column */
+        std::vector<float> output_record;
+
+        /* Writer of the output file, streaming it out in chunks. Null if no file is open. */
+        std::unique_ptr<OutputWriter> output_writer;
+
+        /* Stream formatting into the output writer */
+        std::ostream output_stream{nullptr};
+
+        /* formatter of csv rows */
+        RowFormatter csv_formatter;
+
+        /* formatter of terminal rows */
+        RowFormatter cout_formatter;
+
+        /* wall clock time the terminal was last flushed */
+        std::chrono::steady_clock::time_point previous_terminal_flush;
 };
 
 /**
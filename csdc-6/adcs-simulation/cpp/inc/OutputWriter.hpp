@@ -0,0 +1,154 @@
+/**
+ * @file    OutputWriter.hpp
+ *
+ * @details Header file for the output file writer. Simulation output is streamed to the file in
+ *          large chunks as the run progresses, so memory use does not grow with the length of
+ *          the run and the output of a run that dies part way through is kept.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "adcs_exception.hpp"
+
+/**
+ * @class   OutputWriter
+ *
+ * @details stream buffer that writes to a file in chunks of a fixed size. Used with an ostream
+ *          so the output can be formatted straight into the chunk.
+ *
+ *          With a background thread the writer is double buffered: a full chunk is handed to the
+ *          thread and formatting continues in the other one, so the run only waits on the disk
+ *          if it fills a chunk before the previous one is written. Without one, full chunks are
+ *          written in place. Either way at most two chunks are held in memory.
+**/
+class OutputWriter : public std::streambuf
+{
+    public:
+        /**
+         * @name    OutputWriter constructor
+         *
+         * @param   path        path of the file to write. Any existing file is replaced.
+         * @param   background  true to write chunks on a background thread.
+         * @param   chunk_size  size of each chunk, in bytes.
+         *
+         * @throws  output_write_failure if the file can not be opened.
+        **/
+        OutputWriter(const std::string &path, bool background, size_t chunk_size = default_chunk_size);
+
+        /**
+         * @name    OutputWriter destructor
+         *
+         * @details closes the file if it is still open. Write errors are ignored, call close to
+         *          check for them.
+        **/
+        ~OutputWriter();
+
+        OutputWriter(const OutputWriter &) = delete;
+        OutputWriter &operator=(const OutputWriter &) = delete;
+
+        /**
+         * @name    close
+         *
+         * @details writes out the current chunk, waits for all writes to finish and closes the
+         *          file. Does nothing if the file is already closed.
+         *
+         * @throws  output_write_failure if any write to the file failed.
+        **/
+        void close();
+
+        /* default size of each chunk, in bytes */
+        static constexpr size_t default_chunk_size = 1 << 20;
+
+    protected:
+        /**
+         * @name    overflow
+         *
+         * @details called by the stream when the current chunk is full. Hands the chunk off and
+         *          continues in an empty one.
+        **/
+        int_type overflow(int_type c) override;
+
+        /**
+         * @name    sync
+         *
+         * @details called by the stream on flush. Hands the current chunk off and waits for all
+         *          writes to finish.
+        **/
+        int sync() override;
+
+    private:
+        /**
+         * @name    hand_off
+         *
+         * @details hands the current chunk to the background thread, or writes it if there is
+         *          none, and starts filling an empty chunk.
+        **/
+        void hand_off();
+
+        /**
+         * @name    wait_for_writes
+         *
+         * @details waits until the background thread has written every chunk handed to it.
+        **/
+        void wait_for_writes();
+
+        /**
+         * @name    write_chunks
+         *
+         * @details loop run by the background thread.
+        **/
+        void write_chunks();
+
+        /* the output file */
+        std::ofstream file;
+
+        /* chunk currently being filled */
+        std::vector<char> active;
+
+        /* chunk being written by the background thread */
+        std::vector<char> pending;
+
+        /* number of bytes in the pending chunk, 0 once it has been written */
+        size_t pending_size = 0;
+
+        /* true while the file is open */
+        bool open = false;
+
+        /* true if any write failed */
+        bool failed = false;
+
+        /* set to stop the background thread */
+        bool stopping = false;
+
+        /* background thread, if used */
+        std::thread writer;
+
+        /* guards the pending chunk and the flags shared with the background thread */
+        std::mutex lock;
+
+        /* signalled when the pending chunk is filled or written */
+        std::condition_variable pending_changed;
+};
+
+/**
+ * @exception output_write_failure
+ *
+ * @details exception used to indicate that the output file could not be written.
+**/
+class output_write_failure : public adcs_exception
+{
+    public:
+        output_write_failure(const char* msg) :  adcs_exception(msg) {}
+};
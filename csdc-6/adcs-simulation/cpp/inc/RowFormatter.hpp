@@ -0,0 +1,146 @@
+/**
+ * @file    RowFormatter.hpp
+ *
+ * @details Header file for the row formatter used by the messenger. Rows are formatted with
+ *          std::to_chars into a char buffer that is reused for every row, which is much faster
+ *          than formatting through iostreams when a row is written every millisecond.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "def_interface.hpp"
+
+/**
+ * @class   RowFormatter
+ *
+ * @details formats a single row of output at a time. Floats are written as with printf "%.*g",
+ *          so the default precision gives the same text as the default iostream formatting.
+ *
+ *          The buffer grows to fit the longest row and is then reused, so after the first few
+ *          rows formatting does not allocate.
+**/
+class RowFormatter
+{
+    public:
+        /**
+         * @name    RowFormatter constructor
+         *
+         * @param   precision number of significant digits of each float.
+        **/
+        RowFormatter(int precision = default_precision);
+
+        /**
+         * @name    set_precision
+         *
+         * @param   precision number of significant digits of each float, from 1 to
+         *                    max_precision.
+         *
+         * @throws  invalid_row_format if the precision is out of range.
+        **/
+        void set_precision(int precision);
+
+        /**
+         * @name    get_precision
+         *
+         * @returns the number of significant digits of each float.
+        **/
+        inline int get_precision() const
+        {
+            return precision;
+        }
+
+        /**
+         * @name    clear
+         *
+         * @details starts a new row. The buffer is kept.
+        **/
+        inline void clear()
+        {
+            length = 0;
+        }
+
+        /**
+         * @name    append
+         *
+         * @details appends a float with the set precision.
+        **/
+        void append(float value);
+
+        /**
+         * @name    append
+         *
+         * @details appends text.
+        **/
+        void append(std::string_view text);
+
+        /**
+         * @name    append
+         *
+         * @details appends a single character.
+        **/
+        void append(char character);
+
+        /**
+         * @name    append_timestamp
+         *
+         * @details appends a timestamp, in the same format as timestamp::pretty_string.
+        **/
+        void append_timestamp(timestamp time);
+
+        /**
+         * @name    view
+         *
+         * @returns the row so far. Only valid until the next change to the row.
+        **/
+        inline std::string_view view() const
+        {
+            return std::string_view(buffer.data(), length);
+        }
+
+        /* default number of significant digits, the same as iostreams */
+        static constexpr int default_precision = 6;
+
+        /* largest number of significant digits, enough to represent any float exactly */
+        static constexpr int max_precision = 9;
+
+    private:
+        /**
+         * @name    make_room
+         *
+         * @details grows the buffer if there are fewer than the given number of chars free.
+        **/
+        void make_room(size_t chars);
+
+        /* longest float, with sign, max_precision digits, point and exponent */
+        static constexpr size_t max_float_chars = 24;
+
+        /* longest timestamp */
+        static constexpr size_t max_timestamp_chars = 32;
+
+        /* the row, followed by free space */
+        std::vector<char> buffer;
+
+        /* length of the row */
+        size_t length = 0;
+
+        /* number of significant digits of each float */
+        int precision = default_precision;
+};
+
+/**
+ * @exception invalid_row_format
+ *
+ * @details exception used to indicate that a row format setting is not valid.
+**/
+class invalid_row_format : public adcs_exception
+{
+    public:
+        invalid_row_format(const char* msg) :  adcs_exception(msg) {}
+};
@@ -0,0 +1,173 @@
+/**
+ * @file    SGP4.hpp
+ *
+ * @details Header file for the SGP4 orbit propagator. Parses two line element sets (TLEs) and
+ *          propagates them to the position and velocity of the satellite, following the
+ *          Spacetrack Report #3 model as revised by Vallado et al. (2006), with the WGS-72
+ *          constants the element sets are made with.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <string>
+#include <Eigen/Dense>
+
+#include "adcs_exception.hpp"
+
+/**
+ * @struct  tle_elements
+ *
+ * @details the mean elements of a two line element set, in the units given in the TLE.
+ *
+ * @param satellite_number  NORAD catalogue number of the satellite.
+ * @param epoch             epoch of the elements, as a Julian date (UTC).
+ * @param bstar             drag term, in 1/earth radii.
+ * @param inclination       inclination, in degrees.
+ * @param raan              right ascension of the ascending node, in degrees.
+ * @param eccentricity      eccentricity.
+ * @param arg_of_perigee    argument of perigee, in degrees.
+ * @param mean_anomaly      mean anomaly, in degrees.
+ * @param mean_motion       mean motion, in revolutions per day.
+**/
+typedef struct
+{
+    uint32_t satellite_number;
+    double   epoch;
+    double   bstar;
+    double   inclination;
+    double   raan;
+    double   eccentricity;
+    double   arg_of_perigee;
+    double   mean_anomaly;
+    double   mean_motion;
+} tle_elements;
+
+/**
+ * @class   SGP4
+ *
+ * @details near earth SGP4 propagator for a single element set. Everything that only depends on
+ *          the elements is computed once by the constructor, so each propagation only evaluates the
+ *          time dependent terms. Positions and velocities are in the True Equator Mean Equinox
+ *          (TEME) frame, in km and km/s.
+ *
+ *          Only near earth orbits (periods under 225 minutes) are supported. The deep space
+ *          (SDP4) terms are not modelled, and element sets that need them are rejected.
+**/
+class SGP4
+{
+    public:
+        /**
+         * @name    SGP4 constructor
+         *
+         * @param   elements the mean elements to propagate.
+         *
+         * @throws  invalid_tle if the elements are not a near earth orbit.
+        **/
+        SGP4(const tle_elements &elements);
+
+        /**
+         * @name    SGP4 constructor
+         *
+         * @param   line_1 the first line of a TLE.
+         * @param   line_2 the second line of a TLE.
+         *
+         * @throws  invalid_tle if the lines can not be parsed, or are not a near earth orbit.
+        **/
+        SGP4(const std::string &line_1, const std::string &line_2);
+
+        /**
+         * @name    parse_tle
+         *
+         * @param   line_1 the first line of a TLE.
+         * @param   line_2 the second line of a TLE.
+         *
+         * @returns the elements of the TLE.
+         *
+         * @throws  invalid_tle if either line is malformed or fails its checksum.
+        **/
+        static tle_elements parse_tle(const std::string &line_1, const std::string &line_2);
+
+        /**
+         * @name    propagate
+         *
+         * @param   minutes  time since the epoch of the elements, in minutes.
+         * @param   position filled with the position of the satellite, in km.
+         * @param   velocity filled with the velocity of the satellite, in km/s.
+         *
+         * @throws  orbit_propagation_error if the orbit has decayed or become unbound.
+        **/
+        void propagate(double minutes, Eigen::Vector3d &position, Eigen::Vector3d &velocity) const;
+
+        /**
+         * @name    propagate
+         *
+         * @details propagates the elements to many times at once, one column per time.
+         *
+         * @param   minutes    times since the epoch of the elements, in minutes.
+         * @param   positions  resized and filled with the position at each time, in km.
+         * @param   velocities resized and filled with the velocity at each time, in km/s.
+         *
+         * @throws  orbit_propagation_error if the orbit has decayed or become unbound at any time.
+        **/
+        void propagate(const Eigen::ArrayXd &minutes, Eigen::Matrix3Xd &positions, Eigen::Matrix3Xd &velocities) const;
+
+        /**
+         * @name    get_elements
+         *
+         * @returns the elements being propagated.
+        **/
+        inline const tle_elements &get_elements() const { return this->elements; }
+
+        /* WGS-72 constants used by SGP4 */
+        static constexpr double earth_radius = 6378.135;           // km
+        static constexpr double earth_mu     = 398600.8;           // km^3/s^2
+        static constexpr double j2           = 0.001082616;
+        static constexpr double j3           = -0.00000253881;
+        static constexpr double j4           = -0.00000165597;
+
+    private:
+        /* elements being propagated */
+        tle_elements elements;
+
+        /* elements in the internal units of radians, earth radii and minutes */
+        double inclination;
+        double raan;
+        double eccentricity;
+        double arg_of_perigee;
+        double mean_anomaly;
+        double mean_motion;
+        double bstar;
+
+        /* true when the perigee is low enough that the higher order drag terms are dropped */
+        bool simple;
+
+        /* terms of the model that only depend on the elements */
+        double aycof, con41, cc1, cc4, cc5, d2, d3, d4, delmo, eta, argpdot, omgcof, sinmao;
+        double t2cof, t3cof, t4cof, t5cof, x1mth2, x7thm1, mdot, nodedot, xlcof, xmcof, nodecf;
+};
+
+/**
+ * @exception invalid_tle
+ *
+ * @details exception used to indicate that a two line element set could not be used.
+**/
+class invalid_tle : public adcs_exception
+{
+    public:
+        invalid_tle(const char* msg) :  adcs_exception(msg) {}
+};
+
+/**
+ * @exception orbit_propagation_error
+ *
+ * @details exception used to indicate that an orbit could not be propagated to a time.
+**/
+class orbit_propagation_error : public adcs_exception
+{
+    public:
+        orbit_propagation_error(const char* msg) :  adcs_exception(msg) {}
+};
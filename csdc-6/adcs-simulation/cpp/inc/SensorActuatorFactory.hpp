@@ -12,9 +12,11 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "sim_interface.hpp"
+#include "ConfigurationSingleton.hpp"
 #include "Simulator.hpp"
 
 
@@ -29,21 +31,34 @@ class SensorActuatorFactory {
 public:
     /**
     * @name GetSensor
+    * @param config the configuration describing the sensor.
     * @param name [string], the name of the sensor
     * @param sim pointer to the simulator that the sensors/actuators will communicate with.
     *
-    * @details getter for a sensor object from singleton class instance. Returns a unique
+    * @details getter for a sensor object from a configuration. Returns a unique
     * pointer of the type of sensor matching the configuration
    **/
-    static std::shared_ptr<Sensor> GetSensor(const std::string &name, Simulator* sim);
+    static std::shared_ptr<Sensor> GetSensor(Configuration &config, const std::string &name, Simulator* sim);
 
     /**
     * @name GetActuator
+    * @param config the configuration describing the actuator.
     * @param name [string], the name of the actuator
     * @param sim pointer to the simulator that the sensors/actuators will communicate with.
     *
-    * @details getter for actuator object from singleton class instance. Returns a unique
+    * @details getter for actuator object from a configuration. Returns a unique
     * pointer of the type of actuator matching the configuration
    **/
-    static std::shared_ptr<Actuator> GetActuator(const std::string &name, Simulator* sim);
+    static std::shared_ptr<Actuator> GetActuator(Configuration &config, const std::string &name, Simulator* sim);
+
+    /**
+    * @name GetFieldReference
+    * @param config the configuration describing the orbit.
+    *
+    * @details getter for the reference the control code compares the magnetometer with, the IGRF
+    * in the inertial frame at the position of the satellite, propagated from the orbit elements of
+    * the configuration. The models are separate from the simulator's, so the reference is never
+    * the simulated truth itself. Returns an empty function if there is no orbit.
+   **/
+    static std::function<Eigen::Vector3f(timestamp)> GetFieldReference(Configuration &config);
 };
@@ -0,0 +1,157 @@
+/**
+ * @file SensorNoise.hpp
+ *
+ * @details header file for the error models of the simulated sensors
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "def_interface.hpp"
+#include "CommonStructs.hpp"
+
+/**
+ * @class CounterRng
+ *
+ * @details Philox4x32-10 counter-based random number generator. Each output is a pure function of
+ *          a key and a counter, so any number of streams can be drawn from in parallel, in any
+ *          order, without sharing or locking a generator: a stream is picked by its key and counter
+ *          fields, and every draw of it is reproducible on its own.
+**/
+class CounterRng {
+public:
+    typedef std::array<uint32_t, 4> counter;
+    typedef std::array<uint32_t, 2> key;
+
+    /**
+     * @name generate
+     * @param ctr [counter], the counter to generate from
+     * @param k [key], the key of the stream
+     *
+     * @returns [counter], four random 32 bit words.
+    **/
+    static counter generate(counter ctr, key k);
+
+    /**
+     * @name normals
+     * @param ctr [counter], the counter to generate from
+     * @param k [key], the key of the stream
+     *
+     * @returns [Eigen::Array4f], four independent standard normal values, made from one block with
+     *          the Box-Muller transform.
+    **/
+    static Eigen::Array4f normals(const counter &ctr, const key &k);
+};
+
+/**
+ * @class SensorNoise
+ *
+ * @details applies the error model of one sensor to its measurements. Random values are only drawn
+ *          when the sensor is sampled, from a stream keyed by the noise seed of the run and the id of
+ *          the sensor, with the number of the sample as the counter. A sensor with a perfect model
+ *          returns its measurements untouched.
+**/
+class SensorNoise {
+public:
+    /**
+     * @name SensorNoise
+     *
+     * @details constructor for a perfect sensor.
+    **/
+    SensorNoise() = default;
+
+    /**
+     * @name SensorNoise
+     * @param model [sensor_noise], the error model of the sensor
+     * @param seed [uint64_t], the noise seed of the run
+     * @param sensor_id [uint32_t], id of the sensor, unique within the run
+     *
+     * @details constructor for a sensor, drawing its initial bias.
+    **/
+    SensorNoise(const sensor_noise &model, uint64_t seed, uint32_t sensor_id);
+
+    /**
+     * @name sample
+     * @param truth [Eigen::Vector3f], the true value being measured
+     * @param time [timestamp], the simulation time of the sample
+     *
+     * @details walks the bias over the time since the last sample and applies the error model.
+     *
+     * @returns [Eigen::Vector3f], the measured value.
+    **/
+    Eigen::Vector3f sample(const Eigen::Vector3f &truth, timestamp time);
+
+    /**
+     * @name sample_attitude
+     * @param truth [Eigen::Vector3f], the true attitude as a rotation vector
+     *
+     * @details rotates the attitude by a random rotation with the attitude noise of the model.
+     *          Draws from the stream of the last call to sample.
+     *
+     * @returns [Eigen::Vector3f], the measured attitude.
+    **/
+    Eigen::Vector3f sample_attitude(const Eigen::Vector3f &truth);
+
+private:
+    /**
+     * @name draw
+     *
+     * @returns [Eigen::Array4f], the next four normal values of the current sample.
+    **/
+    Eigen::Array4f draw();
+
+    /**
+     * @property model [sensor_noise]
+     *
+     * @details the error model of the sensor.
+    **/
+    sensor_noise model;
+
+    /**
+     * @property enabled [bool]
+     *
+     * @details false for a perfect sensor, which skips the model entirely.
+    **/
+    bool enabled = false;
+
+    /**
+     * @property transform [Eigen::Matrix3f]
+     *
+     * @details the scale factor and misalignment of the sensor, combined once.
+    **/
+    Eigen::Matrix3f transform = Eigen::Matrix3f::Identity();
+
+    /**
+     * @property bias [Eigen::Vector3f]
+     *
+     * @details the current bias of the sensor.
+    **/
+    Eigen::Vector3f bias = Eigen::Vector3f::Zero();
+
+    /**
+     * @property stream [CounterRng::key]
+     *
+     * @details key of the random stream, from the noise seed of the run.
+    **/
+    CounterRng::key stream = {};
+
+    /**
+     * @property position [CounterRng::counter]
+     *
+     * @details the counter of the next draw: sample number, draw within the sample, sensor id.
+    **/
+    CounterRng::counter position = {};
+
+    /**
+     * @property last_sample [timestamp]
+     *
+     * @details time of the last sample, the bias walks over the time since.
+    **/
+    timestamp last_sample;
+};
@@ -12,12 +12,44 @@
 
 #pragma once
 
+#include <array>
+#include <chrono>
 #include <memory>
 #include <vector>
 
 #include "def_interface.hpp"
 #include "CommonStructs.hpp"
+#include "DisturbanceModel.hpp"
+#include "DynamicsModel.hpp"
+#include "Integrator.hpp"
+#include "MagneticField.hpp"
 #include "Messenger.hpp"
+#include "SGP4.hpp"
+#include "SensorNoise.hpp"
+
+class Configuration;
+
+/**
+ * @typedef controller_cost_table
+ *
+ * @details modelled run time of the control code for each call it makes into the simulation,
+ *          indexed by ControllerCall.
+**/
+typedef std::array<timestamp, num_controller_calls> controller_cost_table;
+
+/**
+ * @struct device_schedule
+ *
+ * @details polling schedule of a device registered with the simulator.
+ *
+ * @param polling_time  minimum amount of time between polls of the device.
+ * @param next_due      time the device can next be polled.
+**/
+typedef struct
+{
+    timestamp polling_time;
+    timestamp next_due;
+} device_schedule;
 
 /**
  * @class Simulator
@@ -41,24 +73,41 @@ public:
      * @name init
      *
      * @details Initializes the simulation with starting values.
+     *
+     * @param time_mode  how the run time of the control code is accounted for.
+     * @param call_costs modelled cost of each control code call, only used in TimeMode::Virtual.
+     * @param integrator_type numerical integration method used to propagate the simulation.
     **/
-    void init(sim_config initial_values, timestamp timeout, timestamp initial_timestep, bool variableTimestep, timestamp max_timestep, timestamp min_timestep);
+    void init(sim_config initial_values, timestamp timeout, timestamp initial_timestep, bool variableTimestep, timestamp max_timestep, timestamp min_timestep,
+              TimeMode time_mode = TimeMode::Virtual, controller_cost_table call_costs = {}, IntegratorType integrator_type = IntegratorType::Euler);
+
+    /**
+     * @name init
+     *
+     * @details Initializes the simulation with the starting values and settings of a loaded
+     * configuration.
+     *
+     * @param config the configuration to start the simulation from.
+    **/
+    void init(Configuration &config);
 
     /**
      * @name update_simulation
+     * @param call [ControllerCall], the control code call requesting the update
      * @returns [timestamp], the simulation time at the end of calculations
      *
      * @details Updates the simulation based on the amount of time the
      * control code spent running. Used when the control code requests
      * up to date values for a sensor
     **/
-    timestamp update_simulation();
+    timestamp update_simulation(ControllerCall call);
 
     /**
      * @name determine_timestep
      *
      * @details Updates the desired timestep based on an error equation. Restricts the timestep to
-     *          be within the min and max described in the YAML.
+     *          be within the min and max described in the YAML. If the integrator estimates its own
+     *          error the step proposed by the last accepted timestep is used instead.
     **/
     void determine_timestep();
 
@@ -74,36 +123,106 @@ public:
     **/
     timestamp set_adcs_sleep(timestamp duration);
 
+    /**
+     * @name register_device
+     *
+     * @details adds a device to the polling schedule. Called once when a device is created. The
+     *          device can first be polled one polling time after it is registered.
+     *
+     * @param polling_time minimum amount of time between polls of the device.
+     *
+     * @returns the handle of the device in the schedule.
+    **/
+    uint32_t register_device(timestamp polling_time);
+
+    /**
+     * @name device_time_until_ready
+     *
+     * @details finds how long until a device can be polled, from its schedule. This does not
+     *          advance the simulation, the modelled cost of the check is simulated on the next
+     *          call that does.
+     *
+     * @param handle the handle of the device, from register_device.
+     *
+     * @returns 0 if the device can be polled, otherwise the time until it can be.
+    **/
+    timestamp device_time_until_ready(uint32_t handle);
+
+    /**
+     * @name device_polled
+     *
+     * @details schedules the next poll of a device after it has been polled.
+     *
+     * @param handle the handle of the device, from register_device.
+     * @param time   the time the device was polled.
+    **/
+    void device_polled(uint32_t handle, timestamp time);
+
+    /**
+     * @name get_reaction_wheel_handle
+     *
+     * @details finds a reaction wheel by its name in the config. Called once when a reaction wheel
+     *          is created, so the simulator can be called with the handle from then on. Wheels in
+     *          a pyramid can share a position, so they are not found by position.
+     *
+     * @param name name of the reaction wheel in the config.
+     *
+     * @returns the handle of the reaction wheel, its index in the simulated reaction wheels.
+     *
+     * @throws invalid_adcs_param if there is no reaction wheel with the name.
+    **/
+    uint32_t get_reaction_wheel_handle(const std::string &name);
+
     /**
      * @name reaction_wheel_update_desired_state
      * 
      * @details udpates the simulation with the new target state of a reaction wheel.
      * 
-     * @param wheel_position location of the reaction wheel in the satellite body.
+     * @param handle the handle of the reaction wheel, from get_reaction_wheel_handle.
      * @param new_target the new target state of the reactino wheel.
      * 
      * @returns the time of the simulation upon return.
-     * 
-     * 
-     * @note The simulator must figure out which reaction wheel is calling the function by it's 
-     *       position - this may be changed to an ID later.
     **/
-    timestamp reaction_wheel_update_desired_state(Eigen::Vector3f wheel_position, actuator_state new_target);
+    timestamp reaction_wheel_update_desired_state(uint32_t handle, actuator_state new_target);
 
     /**
      * @name reaction_wheel_get_current_state
      * 
      * @details request by a reaction wheel for an update on its current state.
      * 
-     * @param position location of the reaction wheel in the satellite body.
+     * @param handle the handle of the reaction wheel, from get_reaction_wheel_handle.
      * 
      * @returns the current state of the actuator.
-     * 
-     * 
-     * @note The simulator must figure out which reaction wheel is calling the function by it's 
-     *       position - this may be changed to an ID later.
     **/
-    actuator_state reaction_wheel_get_current_state(Eigen::Vector3f position);
+    actuator_state reaction_wheel_get_current_state(uint32_t handle);
+
+    /**
+     * @name get_magnetorquer_handle
+     *
+     * @details finds a magnetorquer by its name in the config. Called once when a magnetorquer
+     *          is created, so the simulator can be called with the handle from then on. Several
+     *          magnetorquers are often at the same position, so they are not found by position.
+     *
+     * @param name name of the magnetorquer in the config.
+     *
+     * @returns the handle of the magnetorquer, its index in the simulated magnetorquers.
+     *
+     * @throws invalid_adcs_param if there is no magnetorquer with the name.
+    **/
+    uint32_t get_magnetorquer_handle(const std::string &name);
+
+    /**
+     * @name magnetorquer_update_dipole
+     *
+     * @details request by a magnetorquer to change its magnetic dipole. The dipole is limited to
+     *          what the magnetorquer can produce, and changes immediately.
+     *
+     * @param handle the handle of the magnetorquer, from get_magnetorquer_handle.
+     * @param dipole the new dipole along the axis of the magnetorquer, in A*m^2.
+     *
+     * @returns the current time at the moment the dipole was changed.
+    **/
+    timestamp magnetorquer_update_dipole(uint32_t handle, float dipole);
 
     /**
      * @name gyroscope_take_measurement
@@ -127,38 +246,173 @@ public:
     **/
     timestamp accelerometer_take_measurement(Eigen::Vector3f *measurement);
 
+    /**
+     * @name magnetometer_take_measurement
+     *
+     * @details request by a magnetometer for an update on its current state. The earth's magnetic
+     *          field is found at the current position of the orbit, and is zero without an orbit.
+     *
+     * @param measurement pointer to fill with the measured magnetic field in the body frame, in T.
+     *
+     * @returns the current time at the moment the measurement was taken.
+    **/
+    timestamp magnetometer_take_measurement(Eigen::Vector3f *measurement);
+
+    /**
+     * @name get_sun_sensor_handle
+     *
+     * @details finds a sun sensor by its name in the config. Called once when a sun sensor is
+     *          created, so the simulator can be called with the handle from then on.
+     *
+     * @param name name of the sun sensor in the config.
+     *
+     * @returns the handle of the sun sensor, its index in the simulated sun sensors.
+     *
+     * @throws invalid_adcs_param if there is no sun sensor with the name.
+    **/
+    uint32_t get_sun_sensor_handle(const std::string &name);
+
+    /**
+     * @name sun_sensor_take_measurement
+     *
+     * @details request by a sun sensor for an update on its current state. The sun is found from
+     *          the current position of the orbit and the date, and is not seen without an orbit
+     *          or in the earth's shadow.
+     *
+     * @param handle  the handle of the sun sensor, from get_sun_sensor_handle.
+     * @param voltage pointer to fill with the voltage of each diode, in V.
+     *
+     * @returns the current time at the moment the measurement was taken.
+    **/
+    timestamp sun_sensor_take_measurement(uint32_t handle, Eigen::Vector4f *voltage);
+
 private:
+    /**
+     * @name get_sim_config
+     *
+     * @param config configuration used to get the simulation initial parameters.
+     *
+     * @returns the initial configuration fo the satellite
+    **/
+    static sim_config get_sim_config(Configuration &config);
+
     /**
      * @name simulate
      * @param t [timestamp], the amount of time to be simulated
      *
      * @details Used to perform the main simulation calculations. Iterates
-     * over each timestep up until the specified timestamp t's worth
-     * of time has been simulated.
+     * over each timestep until exactly the specified timestamp t's worth
+     * of time has been simulated. The last timestep is shortened to land on
+     * the end, or on the timeout if it comes first, so control is returned to
+     * the control code exactly when it is due.
+     *
+     * @throws simulation_timeout once the timeout has been reached.
     **/
     void simulate(timestamp t);
 
     /**
      * @name timestep
      *
-     * @details Used to perform a single timestep of simulation.
+     * @details Used to perform a single timestep of simulation. If the integrator estimates its
+     * own error and the timestep is variable, steps with too large an error are rejected and
+     * retried with a smaller timestep, so timestep_length holds the length of the step taken.
     **/
     void timestep();
 
+    /**
+     * @name update_orbit
+     *
+     * @details Propagates the orbit of the satellite to the current simulation time, if it is
+     * modelled.
+    **/
+    void update_orbit();
+
+    /**
+     * @name external_torque
+     *
+     * @details Finds the torque on the satellite from outside of it, at the start of the timestep:
+     * the disturbances, and the magnetorquers acting against the earth's magnetic field.
+     *
+     * @returns the external torque in the body frame, in N*m.
+    **/
+    Eigen::Vector3f external_torque();
+
+    /**
+     * @name pack_state
+     *
+     * @details Copies the integrated values of system_vals into the packed state.
+    **/
+    void pack_state();
+
+    /**
+     * @name unpack_state
+     *
+     * @details Copies the packed state back into system_vals, applying the rotation of the
+     * timestep to the attitude of the satellite.
+    **/
+    void unpack_state();
+
+    /**
+     * @name error_ratio
+     * @param error [Eigen::VectorXf], the local error estimate of the last step
+     * @returns [float], the largest ratio of the error to the allowed error. Above 1 the step
+     * is rejected.
+    **/
+    float error_ratio(const Eigen::VectorXf &error);
+
+    /**
+     * @name scale_timestep
+     * @param error_ratio [float], the error ratio of the last step
+     * @returns [timestamp], the timestep that is expected to meet the allowed error, restricted to
+     * be within the min and max described in the YAML.
+    **/
+    timestamp scale_timestep(float error_ratio);
+
+    /**
+     * @name limit_timestep
+     * @param t [timestamp], the desired timestep
+     * @returns [timestamp], the timestep restricted to be within the min and max described in
+     * the YAML.
+    **/
+    timestamp limit_timestep(timestamp t);
+
+    /**
+     * @name controller_time
+     * @returns [timestamp], the time the control code has reached. This is ahead of the
+     * simulation time by the controller run time that has not been simulated yet.
+    **/
+    timestamp controller_time();
+
     /**
      * @name determine_time_passed
+     * @param call [ControllerCall], the control code call that returned control to the simulation
      * @returns timestamp
      *
      * @details Used to determine the time the control code spent running in order
-     * to account for the real-life losses due to processing speed. Does not take
-     * into account the processor the control code is running on.
+     * to account for the real-life losses due to processing speed. In TimeMode::Virtual the
+     * time is the modelled cost of the call plus any cost accumulated by calls that did not
+     * advance the simulation. In TimeMode::RealTime it is the wall clock time since control was
+     * last returned to the control code, which does not take into account the processor the
+     * control code is running on.
     **/
-    timestamp determine_time_passed();
+    timestamp determine_time_passed(ControllerCall call);
+
+    /**
+     * @name charge_controller_call
+     * @param call [ControllerCall], the control code call to account for
+     *
+     * @details Accumulates the modelled cost of a call that does not advance the simulation
+     * itself. The cost is simulated on the next call that does.
+    **/
+    void charge_controller_call(ControllerCall call);
 
 private:
     /* max error allowed per timestep in position accuracy - the first term is in degrees */
     const float max_error_in_rad = 0.00005 * M_PI / 180;
 
+    /* max error allowed per timestep relative to the size of each integrated value */
+    const float max_relative_error = 0.00001;
+
     /**
      * @property simulation_time [timestamp]
      *
@@ -169,12 +423,34 @@ private:
     timestamp simulation_time;
 
     /**
-     * @property last_called [timestamp]
+     * @property last_returned [std::chrono::steady_clock::time_point]
+     *
+     * @details The wall clock time that control was last returned to the control code. Used in
+     * TimeMode::RealTime to determine the amount of time that has passed while the control code
+     * was running.
+    **/
+    std::chrono::steady_clock::time_point last_returned;
+
+    /**
+     * @property time_mode [TimeMode]
      *
-     * @details The timestamp that the simulation was last called at. Used to determine
-     * the amount of time that has passed while the control code was running.
+     * @details How the run time of the control code is accounted for.
     **/
-    timestamp last_called;
+    TimeMode time_mode;
+
+    /**
+     * @property call_costs [controller_cost_table]
+     *
+     * @details Modelled run time of each control code call. Only used in TimeMode::Virtual.
+    **/
+    controller_cost_table call_costs;
+
+    /**
+     * @property pending_controller_time [timestamp]
+     *
+     * @details Modelled control code run time that has not been simulated yet.
+    **/
+    timestamp pending_controller_time;
 
     /**
      * @property timestep_length [timestamp]
@@ -205,6 +481,50 @@ private:
     **/
     timestamp min_timestamp;
 
+    /**
+     * @property dynamics [DynamicsModel]
+     *
+     * @details rotational dynamics of the satellite, with the values that are constant for the
+     * run precomputed in init.
+    **/
+    DynamicsModel dynamics;
+
+    /**
+     * @property integrator [std::unique_ptr<Integrator>]
+     *
+     * @details numerical integrator used to advance the simulation each timestep.
+    **/
+    std::unique_ptr<Integrator> integrator;
+
+    /**
+     * @property derivative [Integrator::derivative_function]
+     *
+     * @details the derivative of the dynamics model bound to this simulator, created once so it is
+     * not rebuilt every timestep.
+    **/
+    Integrator::derivative_function derivative;
+
+    /**
+     * @property state [Eigen::VectorXf]
+     *
+     * @details the integrated values of system_vals packed into a single vector.
+    **/
+    Eigen::VectorXf state;
+
+    /**
+     * @property previous_state [Eigen::VectorXf]
+     *
+     * @details the packed state at the start of the timestep, restored when a step is rejected.
+    **/
+    Eigen::VectorXf previous_state;
+
+    /**
+     * @property proposed_timestep [timestamp]
+     *
+     * @details timestep proposed by the error estimate of the last accepted step.
+    **/
+    timestamp proposed_timestep;
+
     /**
      * @property system_vals [sim_config]
      *
@@ -219,6 +539,62 @@ private:
     **/  
     Messenger *messenger;
 
+    /**
+     * @property devices [std::vector<device_schedule>]
+     *
+     * @details polling schedule of each device, indexed by the handle from register_device.
+    **/
+    std::vector<device_schedule> devices;
+
+    /**
+     * @property orbit_model [std::unique_ptr<SGP4>]
+     *
+     * @details propagator of the orbit of the satellite, null if the orbit is not modelled.
+    **/
+    std::unique_ptr<SGP4> orbit_model;
+
+    /**
+     * @property disturbances [std::unique_ptr<DisturbanceTorques>]
+     *
+     * @details external disturbance torques on the satellite, null if none are modelled.
+    **/
+    std::unique_ptr<DisturbanceTorques> disturbances;
+
+    /**
+     * @property magnetic_field [MagneticField]
+     *
+     * @details model of the earth's magnetic field measured by the magnetometer.
+    **/
+    MagneticField magnetic_field;
+
+    /**
+     * @property gyroscope_noise [SensorNoise]
+     *
+     * @details error model applied to the measurements of the gyroscope.
+    **/
+    SensorNoise gyroscope_noise;
+
+    /**
+     * @property accelerometer_noise [SensorNoise]
+     *
+     * @details error model applied to the measurements of the accelerometer.
+    **/
+    SensorNoise accelerometer_noise;
+
+    /**
+     * @property magnetometer_noise [SensorNoise]
+     *
+     * @details error model applied to the measurements of the magnetometer.
+    **/
+    SensorNoise magnetometer_noise;
+
+    /**
+     * @property sun_sensor_noise [vector<SensorNoise>]
+     *
+     * @details error model applied to the direction of the sun seen by each sun sensor.
+    **/
+    std::vector<SensorNoise> sun_sensor_noise;
+
     /**
      * @property timeout [timestamp]
      * 
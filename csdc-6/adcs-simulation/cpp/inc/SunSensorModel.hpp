@@ -0,0 +1,49 @@
+/**
+ * @file    SunSensorModel.hpp
+ *
+ * @details Header file for the model of the diode voltages of the two dimensional sun sensor.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <Eigen/Dense>
+
+#include "SunSensorCalibration.hpp"
+
+/**
+ * @class   SunSensorModel
+ *
+ * @details the response of each diode of a sun sensor to the angle of the sun in the plane of the
+ *          sensor, from the same bench calibration the flight decoder uses. The calibration curves
+ *          are inverted at compile time into a table of voltage against angle, so a measurement is
+ *          one lookup per diode. The voltages scale with the sunlight reaching the plane of the
+ *          sensor, so the sun out of the plane makes every diode dimmer, and diodes below the
+ *          calibration's noise floor read 0 V.
+**/
+class SunSensorModel
+{
+    public:
+        /**
+         * @name    voltages
+         *
+         * @param   sun             the direction of the sun in the body frame, scaled by the
+         *                          sunlight from 0 in the earth's shadow to 1.
+         * @param   axis            unit vector diode 0 faces, in the body frame.
+         * @param   perpendicular   unit vector 90 degrees from the axis in the plane of the sensor.
+         * @param   max_voltage     voltage of a diode facing the sun directly, in V.
+         *
+         * @returns the voltage of each diode, in V.
+        **/
+        static Eigen::Vector4f voltages(const Eigen::Vector3f &sun, const Eigen::Vector3f &axis,
+                                        const Eigen::Vector3f &perpendicular, float max_voltage);
+
+        /* spacing of the angles of the response table, in degrees */
+        static constexpr float resolution = 0.5f;
+
+        /* number of angles in the response table of each diode */
+        static constexpr size_t table_size = static_cast<size_t>(360 / resolution);
+};
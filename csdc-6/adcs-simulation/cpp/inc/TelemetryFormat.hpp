@@ -0,0 +1,64 @@
+/**
+ * @file    TelemetryFormat.hpp
+ *
+ * @details Describes the binary telemetry output format. A binary output file is a self
+ *          describing header followed by fixed width records, one per output row:
+ *
+ *          telemetry_header
+ *          column names, each terminated by a null character
+ *          zero padding, up to header_size bytes
+ *          records, each num_columns floats in the byte order of the machine that wrote them
+ *
+ *          The header size is a multiple of header_alignment so the records can be used in place
+ *          when the file is memory mapped. The number of records is not stored, it is found from
+ *          the file size, so a partially written file can still be read.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <cstdint>
+
+namespace Telemetry
+{
+    /* identifies a binary telemetry file */
+    constexpr char magic[8] = {'A', 'D', 'C', 'S', 'T', 'L', 'M', '\0'};
+
+    /* version of the format, increased on any incompatible change */
+    constexpr uint32_t version = 1;
+
+    /* written as is, so a reader on a machine of the other byte order can detect it */
+    constexpr uint32_t byte_order_mark = 0x01020304;
+
+    /* alignment of the first record, in bytes */
+    constexpr uint32_t header_alignment = 16;
+
+    /* extension of binary telemetry files */
+    constexpr const char *extension = ".bin";
+
+    /**
+     * @struct  telemetry_header
+     *
+     * @details fixed part of the header at the start of every binary telemetry file.
+     *
+     * @param magic                 always Telemetry::magic.
+     * @param version               always Telemetry::version.
+     * @param byte_order_mark       always Telemetry::byte_order_mark, in the writer's byte order.
+     * @param header_size           size of the whole header including the column names, in bytes.
+     *                              The first record starts here.
+     * @param num_columns           number of floats in each record.
+     * @param num_reaction_wheels   number of reaction wheels in the run.
+    **/
+    typedef struct
+    {
+        char     magic[8];
+        uint32_t version;
+        uint32_t byte_order_mark;
+        uint32_t header_size;
+        uint32_t num_columns;
+        uint32_t num_reaction_wheels;
+    } telemetry_header;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file    TelemetryReader.hpp
+ *
+ * @details Reader for binary telemetry files, as described in TelemetryFormat.hpp. The file is
+ *          memory mapped, and columns and records are exposed as Eigen maps into the mapping, so
+ *          nothing is copied or parsed no matter how long the run was.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <Eigen/Dense>
+
+#include "TelemetryFormat.hpp"
+#include "adcs_exception.hpp"
+
+/**
+ * @class   TelemetryReader
+ *
+ * @details read only view of a binary telemetry file. The maps returned are only valid while the
+ *          reader exists.
+**/
+class TelemetryReader
+{
+    public:
+        /* a single column, every num_columns floats in the file */
+        typedef Eigen::Map<const Eigen::VectorXf, Eigen::Unaligned, Eigen::InnerStride<>> column_view;
+
+        /* a single record */
+        typedef Eigen::Map<const Eigen::VectorXf> record_view;
+
+        /* every record, one per row */
+        typedef Eigen::Map<const Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> table_view;
+
+        /**
+         * @name    TelemetryReader constructor
+         *
+         * @details maps the file and checks its header.
+         *
+         * @param   path path to the binary telemetry file.
+         *
+         * @throws  telemetry_read_failure if the file can not be mapped or is not a binary
+         *          telemetry file written on a machine of the same byte order.
+        **/
+        TelemetryReader(const std::string &path);
+
+        /**
+         * @name    TelemetryReader destructor
+         *
+         * @details unmaps the file.
+        **/
+        ~TelemetryReader();
+
+        TelemetryReader(const TelemetryReader &) = delete;
+        TelemetryReader &operator=(const TelemetryReader &) = delete;
+
+        /**
+         * @name    get_num_records
+         *
+         * @returns the number of complete records in the file.
+        **/
+        inline uint64_t get_num_records() const
+        {
+            return num_records;
+        }
+
+        /**
+         * @name    get_num_columns
+         *
+         * @returns the number of floats in each record.
+        **/
+        inline uint32_t get_num_columns() const
+        {
+            return header.num_columns;
+        }
+
+        /**
+         * @name    get_num_reaction_wheels
+         *
+         * @returns the number of reaction wheels in the run.
+        **/
+        inline uint32_t get_num_reaction_wheels() const
+        {
+            return header.num_reaction_wheels;
+        }
+
+        /**
+         * @name    get_column_names
+         *
+         * @returns the name of each column, in the order they appear in a record.
+        **/
+        inline const std::vector<std::string> &get_column_names() const
+        {
+            return column_names;
+        }
+
+        /**
+         * @name    get_column_index
+         *
+         * @param   name the name of the column, as in the csv header.
+         *
+         * @returns the index of the column in a record.
+         *
+         * @throws  telemetry_read_failure if there is no column with the name.
+        **/
+        uint32_t get_column_index(const std::string &name) const;
+
+        /**
+         * @name    column
+         *
+         * @param   index the index of the column in a record.
+         *
+         * @returns the column, with one value for each record.
+        **/
+        column_view column(uint32_t index) const;
+
+        /**
+         * @name    column
+         *
+         * @param   name the name of the column, as in the csv header.
+         *
+         * @returns the column, with one value for each record.
+        **/
+        column_view column(const std::string &name) const;
+
+        /**
+         * @name    record
+         *
+         * @param   index the index of the record.
+         *
+         * @returns the record, with one value for each column.
+        **/
+        record_view record(uint64_t index) const;
+
+        /**
+         * @name    table
+         *
+         * @returns every record, with one row per record and one column per column.
+        **/
+        table_view table() const;
+
+    private:
+        /* fixed part of the header */
+        Telemetry::telemetry_header header;
+
+        /* column names from the header */
+        std::vector<std::string> column_names;
+
+        /* start of the file mapping */
+        void *mapping = nullptr;
+
+        /* size of the file mapping, in bytes */
+        size_t mapping_size = 0;
+
+        /* first record */
+        const float *records = nullptr;
+
+        /* number of complete records */
+        uint64_t num_records = 0;
+};
+
+/**
+ * @exception telemetry_read_failure
+ *
+ * @details exception used to indicate that a binary telemetry file could not be read.
+**/
+class telemetry_read_failure : public adcs_exception
+{
+    public:
+        telemetry_read_failure(const char* msg) :  adcs_exception(msg) {}
+};
@@ -26,6 +26,7 @@
 #include "ConfigurationSingleton.hpp"
 #include "Messenger.hpp"
 #include "HelpMessages.hpp"
+#include "Executive.hpp"
 
 /**
  * @class   UI
@@ -94,6 +95,8 @@ class UI
          *              --csv_rate r    - sets the csv print rate to r (ms) (optional)
          *              --print_rate r  - sets the terminal print rate to r (ms) (optional)
          *              --silence_plots - prevents writing to the output csv (optional)
+         *              --binary        - writes a binary output file instead of a csv (optional)
+         *              --precision d   - sets the csv and terminal output to d significant digits (optional)
          *
          * @param args the user input arguments. Arguments are as follows:
          *              args[0]  command "clean_out"
@@ -106,6 +109,7 @@ class UI
         /**
          * @name create_sensor
          *
+         * @param config the configuration describing the sensor.
          * @param name [string], the name of the sensor to be created
          * @param sim  [Simulator*], the simulator pointer to be used in the sensor constructor.
          * @param sensors an unordered map to populate with the sensor.
@@ -113,11 +117,12 @@ class UI
          * @details creates a sensor object and populates it in an unordered map to be used by the
          *          control code.
         **/
-        void create_sensor(const std::string &name, Simulator *sim, std::unordered_map<std::string, std::shared_ptr<Sensor>> *sensors);
+        void create_sensor(Configuration &config, const std::string &name, Simulator *sim, std::unordered_map<std::string, std::shared_ptr<Sensor>> *sensors);
 
         /**
          * @name create_actuator
          *
+         * @param config the configuration describing the actuator.
          * @param name [string], the name of the actuator to be created
          * @param sim  [Simulator*], the simulator pointer to be used in the actuator constructor.
          * @param actuators an unordered map to populate with the actuator.
@@ -125,16 +130,40 @@ class UI
          * @details creates an actuator object and populates it in an unordered map to be used by the
          *          control code.
         **/
-        void create_actuator(const std::string &name, Simulator *sim, std::unordered_map<std::string, std::shared_ptr<Actuator>> *actuators);
+        void create_actuator(Configuration &config, const std::string &name, Simulator *sim, std::unordered_map<std::string, std::shared_ptr<Actuator>> *actuators);
 
         /**
-         * @name get_sim_config
+         * @name report_task_stats
          *
-         * @param config configuration singleton used to get the simulation initial parameters.
+         * @param executive the executive that ran the control code tasks.
          *
-         * @returns the initial configuration fo the satellite
+         * @details sends the run time statistics of each control code task to the user.
         **/
-        sim_config get_sim_config(Configuration &config);
+        void report_task_stats(const Executive &executive);
+
+        /**
+         * @name report_rejected_commands
+         *
+         * @param rejected_commands the number of actuator commands the control code could not apply.
+         *
+         * @details warns the user if any actuator commands were rejected.
+        **/
+        void report_rejected_commands(uint32_t rejected_commands);
+
+        /**
+         * @name    run_campaign
+         *
+         * @details Input command to run a Monte-Carlo campaign of the controller. Runs many
+         *          simulations with randomly perturbed parameters in parallel, and saves a summary
+         *          of each run to a csv file in the output directory.
+         *
+         * @param args the user input arguments. Arguments are as follows:
+         *              args[0] command "campaign"
+         *              args[1] path to the base initial conditions YAML file
+         *              args[2] path to the "stop conditions" YAML file
+         *              args[3] path to the campaign YAML file
+        **/
+        void run_campaign(std::vector<std::string> args);
 
         /**
          * @name    resume_simulation
@@ -192,6 +221,55 @@ class UI
         **/
         void run_no_controller_unit_tests(std::vector<std::string> args);
 
+        /**
+         * @name    run_orbit_unit_tests
+         *
+         * @details runs all the orbit tests. Each propagates the Orbit block of a config yaml and
+         *          compares the position and velocity against published SGP4 results.
+         *
+         * @param args the user input arguments. Arguments are as follows:
+         *             args[0] command "unit_test"
+        **/
+        void run_orbit_unit_tests(std::vector<std::string> args);
+
+        /**
+         * @name    run_sun_sensor_unit_tests
+         *
+         * @details runs all the sun sensor tests. Each sweeps the sun around a sun sensor at an
+         *          angle out of its plane, and compares the angle decoded from the voltages of the
+         *          sun sensor model with the true angle.
+         *
+         * @param args the user input arguments. Arguments are as follows:
+         *             args[0] command "unit_test"
+        **/
+        void run_sun_sensor_unit_tests(std::vector<std::string> args);
+
+        /**
+         * @name    run_attitude_filter_unit_tests
+         *
+         * @details runs all the attitude filter tests. Each feeds the filter noisy measurements of
+         *          a satellite turning at a constant rate, with a biased gyroscope, and compares the
+         *          attitude and bias it estimates with the truth.
+         *
+         * @param args the user input arguments. Arguments are as follows:
+         *             args[0] command "unit_test"
+        **/
+        void run_attitude_filter_unit_tests(std::vector<std::string> args);
+
+        /**
+         * @name    run_regression_unit_tests
+         *
+         * @details runs all the regression tests. Each runs the controller without any output, and
+         *          passes if the controller reaches the goal of its mode (pointing within the
+         *          required accuracy, or detumbling) without any actuator command being rejected.
+         *          A pointing test with magnetorquers must also dump at least half the wheel
+         *          momentum across the magnetic field.
+         *
+         * @param args the user input arguments. Arguments are as follows:
+         *             args[0] command "unit_test"
+        **/
+        void run_regression_unit_tests(std::vector<std::string> args);
+
         /**
          * @name    run_controller_unit_tests
          *
@@ -258,7 +336,7 @@ class UI
         bool terminal_active;
 
         /* Max number of args for the "start_sim" command */
-        const uint8_t max_run_simulation_args = 9;
+        const uint8_t max_run_simulation_args = 12;
 
         /* Min number of args for the "start_sim" command */
         const uint8_t min_run_simulation_args = 2;
@@ -281,6 +359,9 @@ class UI
         /* Number of expected args for the "clean_plots" command */
         const uint8_t num_clean_plots_args = 1;
 
+        /* Number of expected args for the "campaign" command */
+        const uint8_t num_campaign_args = 4;
+
         /* Number of max args for the "help" command */
         const uint8_t max_help_args = 2;
 
@@ -293,6 +374,15 @@ class UI
         /* Path where yamls describing unit tests are expected */
         const std::string expected_controller_unit_test_dir = "unit_tests/controller/";
 
+        /* Path where yamls describing orbit tests are expected */
+        const std::string orbit_unit_test_dir = "unit_tests/orbit/";
+
+        /* Directory of the expected orbit test results, relative to the orbit test directory */
+        const std::string orbit_expected_results_dir = "expected_results/";
+
+        /* Path where yamls describing regression tests are expected */
+        const std::string regression_unit_test_dir = "unit_tests/regression/";
+
         /* Path where yamls describing unit tests are expected */
         const std::string expected_results_dir = "unit_tests/no_controller/expected_results/";
 
@@ -305,6 +395,9 @@ class UI
         /* unit test name prefix (without the number) */
         const std::string unit_test_name = "unit_test_";
 
+        /* orbit test name prefix (without the number) */
+        const std::string orbit_test_name = "orbit_test_";
+
         /* unit test name prefix for the sim config (without the number) */
         const std::string ut_controller_config_name = "test_config_";
 
@@ -314,6 +407,9 @@ class UI
         /* unit test name prefix for the sim exit yaml (without the number) */
         const std::string controller_test_output_name = "unit_test_out_";
 
+        /* name of the campaign summary csv (without the number or file extension) */
+        const std::string campaign_output_name = "campaign_out";
+
         /* path to the perfomance test config yaml file (without the number or file extension) */
         const std::string perf_test_config_yaml_path = "unit_tests/performance/perf_test_config_";
 
@@ -340,11 +436,50 @@ class UI
         const uint8_t num_performance_tests = 5;
 
         /* number of unit tests to run without the controller */
-        const uint8_t num_no_controller_unit_tests = 6;
+        const uint8_t num_no_controller_unit_tests = 7;
 
         /* number of unit tests to run with the controller */
         const uint8_t num_controller_unit_tests = 3;
 
+        /* number of orbit tests to run */
+        const uint8_t num_orbit_unit_tests = 1;
+
+        /* largest position error of an orbit test that passes, in km */
+        const double orbit_position_tolerance = 1e-3;
+
+        /* largest velocity error of an orbit test that passes, in km/s */
+        const double orbit_velocity_tolerance = 1e-6;
+
+        /* angle of the sun out of the plane of the sun sensor in each sun sensor test, in degrees */
+        const std::vector<float> sun_sensor_test_elevations = {0, 30, 60};
+
+        /* step between the angles of the sun in each sun sensor test, in degrees */
+        const float sun_sensor_test_step = 0.1;
+
+        /* largest decoding error of a sun sensor test where two diodes are lit, in degrees */
+        const float sun_sensor_pair_tolerance = 0.5;
+
+        /* largest decoding error of a sun sensor test where only one diode is lit, in degrees */
+        const float sun_sensor_single_tolerance = 10;
+
+        /* number of attitude filter tests to run */
+        const uint8_t num_attitude_filter_unit_tests = 3;
+
+        /* length of each attitude filter test, in s */
+        const float attitude_filter_test_time = 120;
+
+        /* largest attitude error at the end of an attitude filter test that passes, in degrees */
+        const float attitude_filter_attitude_tolerance = 0.2;
+
+        /* largest gyroscope bias error at the end of an attitude filter test that passes, in rad/s */
+        const float attitude_filter_bias_tolerance = 1e-4;
+
+        /* number of regression tests to run */
+        const uint8_t num_regression_unit_tests = 4;
+
+        /* largest fraction of the wheel momentum across the field a pointing regression test with magnetorquers may end with */
+        const float regression_dump_fraction = 0.5;
+
         /* default value of the silent plots flag */
         const bool default_silent_plots = false;
 
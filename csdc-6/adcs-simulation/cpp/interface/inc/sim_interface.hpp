@@ -32,7 +32,8 @@ class ADCS_device {
         /**
          * @name ADCS_device constructor
          *
-         * @details constructor for ADCS_device.
+         * @details constructor for ADCS_device. Registers the device with the polling schedule
+         *          of the simulator.
          * 
          * @param polling_time the minimum amount of time between polling events for the device
          * @param sim          simulator object used to update and get updates about the device
@@ -49,20 +50,27 @@ class ADCS_device {
         /**
          * @name    time_until_ready
          *
-         * @details this function determines how long until the device is ready to be polled.
+         * @details this function determines how long until the device is ready to be polled. It
+         *          is answered from the polling schedule, so the simulation is not advanced.
          *
          * @returns 0 if the device is already in a good state, otherwise the amount of time until
          *          it is ready to be polled again.
         **/
         virtual timestamp time_until_ready();
 
+        /**
+         * @name    get_polling_time
+         *
+         * @returns the minimum amount of time between polling events for the device.
+        **/
+        timestamp get_polling_time();
+
     private:
-        // TODO: This may need an accessor - for now not implementing.
-        /* Minimum amount of time that must pass between each time the device is polled.**/
-        timestamp min_polling_increment;
+        /* Handle of the device in the polling schedule of the simulator.**/
+        uint32_t device_handle;
 
-        /* Last time the device was polled.**/
-        timestamp last_polled;
+        /* Minimum amount of time between polling events for the device.**/
+        timestamp polling_time;
 
     protected:
         /**
@@ -220,6 +228,21 @@ class Actuator : public ADCS_device
             return;
         } // MAY NEED TO REMOVE THIS OR CHANGE IT
 
+        /**
+         * @name    try_set_target_state
+         *
+         * @details non-throwing version of set_target_state.
+         *
+         * @param   target_state the new state the control code would like to be in.
+         *
+         * @returns the target state that was set, or why it was not.
+        **/
+        virtual device_result<actuator_state> try_set_target_state(actuator_state target_state)
+        {
+            this->target_state = target_state;
+            return {device_status::ok, target_state, 0};
+        }
+
         /**
          * @name    get_position
          *
@@ -246,6 +269,14 @@ class Actuator : public ADCS_device
         **/
        float get_max_acceleration();
 
+        /**
+         * @name get_max_velocity
+         * @returns [float], the maximum velocity of the actuator
+         * 
+         * @details accessor for the max velocity of the actuator
+        **/
+       float get_max_velocity();
+
     protected:
         /**
          * @name    set_current_state
@@ -269,6 +300,17 @@ class Actuator : public ADCS_device
         **/
         void check_valid_state(actuator_state state);
 
+        /**
+         * @name    is_valid_state
+         *
+         * @details checks if the provided state is valid, without throwing.
+         *
+         * @param state the state to check
+         *
+         * @returns true if the state is within the limits of the actuator.
+        **/
+        bool is_valid_state(actuator_state state);
+
         // is this ever used?
         /* Target state of the actuator. */
         actuator_state target_state;
@@ -359,6 +401,140 @@ class Accelerometer : public Sensor {
          * @returns the required measurement if succesful.
         **/
         measurement take_measurement();
+
+        /**
+         * @name    try_take_measurement
+         *
+         * @details takes a measurement if the sensor is ready. The simulation is also told to
+         *          update. Never throws device_not_ready.
+         *
+         * @returns the measurement, or the time until the sensor is ready.
+        **/
+        device_result<measurement> try_take_measurement();
+};
+
+/**
+ * @class magnetometer
+ *
+ * @details concrete Sensor implementation for magnetometers
+ *
+ * @implements ADCS_device, Sensor
+**/
+class Magnetometer : public Sensor {
+    public:
+        /**
+         * @name Magnetometer constructor
+         * 
+         * @details all values are directly passed to the Sensor base class. Number of sensors is
+         *          one, and the number of axes is 3.
+         * 
+         * @param polling_time  polling time of the sensor
+         * @param sim           simulator object used to update and get updates about the device
+         * @param positions     positions of all sensor locations on the satellite
+        */
+        Magnetometer(timestamp polling_time, Simulator* sim, Eigen::Vector3f positions) : Sensor(polling_time, sim, {positions}, 1, 3) {}
+
+        /**
+         * @name    take_measurement
+         *
+         * @details this function takes a measurement using the sensor. The simulation is also told
+         *          to update.
+         *
+         * @returns the measured magnetic field in the body frame, in T, if succesful.
+        **/
+        measurement take_measurement();
+
+        /**
+         * @name    try_take_measurement
+         *
+         * @details takes a measurement if the sensor is ready. The simulation is also told to
+         *          update. Never throws device_not_ready.
+         *
+         * @returns the measurement, or the time until the sensor is ready.
+        **/
+        device_result<measurement> try_take_measurement();
+};
+
+/**
+ * @class SunSensor
+ *
+ * @details concrete Sensor implementation for two dimensional sun sensors, a ring of four
+ *          photodiodes in one plane. The voltages are decoded into the angle of the sun by the
+ *          control code.
+ *
+ * @implements ADCS_device, Sensor
+**/
+class SunSensor : public Sensor {
+    public:
+        /**
+         * @name SunSensor constructor
+         *
+         * @details the polling time, simulator and position are passed to the Sensor base class.
+         *          Number of sensors is one, and the number of axes is 3.
+         *
+         * @param polling_time  polling time of the sensor
+         * @param sim           simulator object used to update and get updates about the device
+         * @param position      position of the sensor on the satellite
+         * @param axis          direction diode 0 faces, in the body frame
+         * @param normal        normal of the plane of the diodes, in the body frame
+         * @param max_voltage   voltage of a diode facing the sun directly, in V
+         * @param handle        handle of the sensor in the simulator
+        **/
+        SunSensor(timestamp polling_time, Simulator* sim, Eigen::Vector3f position, Eigen::Vector3f axis, Eigen::Vector3f normal, float max_voltage, uint32_t handle);
+
+        /**
+         * @name    get_axis
+         *
+         * @returns the direction diode 0 faces, in the body frame.
+        **/
+        Eigen::Vector3f get_axis();
+
+        /**
+         * @name    get_normal
+         *
+         * @returns the normal of the plane of the diodes, in the body frame.
+        **/
+        Eigen::Vector3f get_normal();
+
+        /**
+         * @name    get_max_voltage
+         *
+         * @returns the voltage of a diode facing the sun directly, in V.
+        **/
+        float get_max_voltage();
+
+        /**
+         * @name    take_measurement
+         *
+         * @details this function takes a measurement using the sensor. The simulation is also told
+         *          to update.
+         *
+         * @returns the voltage of each diode if succesful.
+        **/
+        sun_sensor_state take_measurement();
+
+        /**
+         * @name    try_take_measurement
+         *
+         * @details takes a measurement if the sensor is ready. The simulation is also told to
+         *          update. Never throws device_not_ready.
+         *
+         * @returns the measurement, or the time until the sensor is ready.
+        **/
+        device_result<sun_sensor_state> try_take_measurement();
+
+    private:
+        /* direction diode 0 faces, in the body frame */
+        Eigen::Vector3f axis;
+
+        /* normal of the plane of the diodes, in the body frame */
+        Eigen::Vector3f normal;
+
+        /* voltage of a diode facing the sun directly */
+        float max_voltage;
+
+        /* handle of the sensor in the simulator */
+        uint32_t handle;
 };
 
 /**
@@ -391,6 +567,16 @@ class Gyroscope : public Sensor {
          * @returns the required measurement if succesful.
         **/
         gyro_state take_measurement();
+
+        /**
+         * @name    try_take_measurement
+         *
+         * @details takes a measurement if the sensor is ready. The simulation is also told to
+         *          update. Never throws device_not_ready.
+         *
+         * @returns the measurement, or the time until the sensor is ready.
+        **/
+        device_result<gyro_state> try_take_measurement();
 };
 
 /**
@@ -406,10 +592,13 @@ class Reaction_wheel : public Actuator
         /**
          * @name Reaction_wheel constructor
          *
-         * @details constructor for the Reaction_wheel. All parameters are passed to the Actuator
-         *          base class.
+         * @details constructor for the Reaction_wheel. All parameters except the handle are
+         *          passed to the Actuator base class.
+         *
+         * @param handle the handle of the simulated reaction wheel, from
+         *               Simulator::get_reaction_wheel_handle.
         **/
-        Reaction_wheel(timestamp polling_time, Simulator* sim, Eigen::Vector3f position, actuator_state max_vals, actuator_state min_vals, actuator_state initial_vals, Eigen::Vector3f axis_of_rotation, float inertia_matrix);
+        Reaction_wheel(timestamp polling_time, Simulator* sim, Eigen::Vector3f position, actuator_state max_vals, actuator_state min_vals, actuator_state initial_vals, Eigen::Vector3f axis_of_rotation, float inertia_matrix, uint32_t handle);
 
         /**
          * @name    get_inertia_matrix
@@ -433,6 +622,19 @@ class Reaction_wheel : public Actuator
         **/
         void set_target_state(actuator_state target_state);
 
+        /**
+         * @name    try_set_target_state
+         *
+         * @details sets the target state if the reaction wheel is ready and the state is valid.
+         *          Updates the simulation when the state is set. Never throws device_not_ready or
+         *          invalid_actuator_state.
+         *
+         * @param   target_state the new state the control code would like to be in.
+         *
+         * @returns the target state that was set, or why it was not.
+        **/
+        device_result<actuator_state> try_set_target_state(actuator_state target_state);
+
         /**
          * @name    get_current_state
          *
@@ -452,6 +654,76 @@ class Reaction_wheel : public Actuator
          *          have the same inertia matrix in their frame of reference.
         **/
         float inertia_matrix;
+
+        /**
+         * @name    handle
+         *
+         * @details handle of the simulated reaction wheel, used for every call to the simulator.
+        **/
+        uint32_t handle;
+};
+
+
+/**
+ * @class Magnetorquer
+ *
+ * @details concrete Actuator implementation for magnetorquers. A magnetorquer is commanded with
+ *          the magnetic dipole it produces along its axis, rather than with an actuator_state.
+ *
+ * @implements ADCS_device, Actuator
+**/
+class Magnetorquer : public Actuator
+{
+    public:
+        /**
+         * @name Magnetorquer constructor
+         *
+         * @details constructor for the Magnetorquer. The polling time, position and axis are
+         *          passed to the Actuator base class.
+         *
+         * @param max_dipole the largest dipole the magnetorquer can produce, in A*m^2.
+         * @param handle     the handle of the simulated magnetorquer, from
+         *                   Simulator::get_magnetorquer_handle.
+        **/
+        Magnetorquer(timestamp polling_time, Simulator* sim, Eigen::Vector3f position, Eigen::Vector3f axis, float max_dipole, uint32_t handle);
+
+        /**
+         * @name    get_max_dipole
+         *
+         * @returns the largest dipole the magnetorquer can produce, in A*m^2.
+        **/
+        float get_max_dipole();
+
+        /**
+         * @name    set_dipole
+         *
+         * @details sets the dipole of the magnetorquer. Updates the simulation when called.
+         *
+         * @param   dipole the dipole along the axis of the magnetorquer, in A*m^2.
+         *
+         * @throws  invalid_actuator_state if the dipole is larger than the magnetorquer can produce.
+         * @throws  device_not_ready if the magnetorquer is not ready.
+        **/
+        void set_dipole(float dipole);
+
+        /**
+         * @name    try_set_dipole
+         *
+         * @details sets the dipole if the magnetorquer is ready and the dipole is within its
+         *          limit. Never throws device_not_ready or invalid_actuator_state.
+         *
+         * @param   dipole the dipole along the axis of the magnetorquer, in A*m^2.
+         *
+         * @returns the dipole that was set, or why it was not.
+        **/
+        device_result<float> try_set_dipole(float dipole);
+
+    private:
+        /* the largest dipole the magnetorquer can produce, in A*m^2 */
+        float max_dipole;
+
+        /* handle of the simulated magnetorquer, used for every call to the simulator */
+        uint32_t handle;
 };
 
 #endif
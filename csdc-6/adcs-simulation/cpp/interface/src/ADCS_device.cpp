@@ -16,7 +16,7 @@
 #include "sim_interface.hpp"
 #include "Simulator.hpp"
 
-ADCS_device::ADCS_device(timestamp polling_time, Simulator* sim) : min_polling_increment(polling_time)
+ADCS_device::ADCS_device(timestamp polling_time, Simulator* sim)
 {
 	if (nullptr == sim)
 	{
@@ -24,24 +24,21 @@ ADCS_device::ADCS_device(timestamp polling_time, Simulator* sim) : min_polling_i
 	}
 
 	this->sim = sim;
-	this->last_polled = 0;
+	this->polling_time = polling_time;
+	this->device_handle = sim->register_device(polling_time);
 }
 
-timestamp ADCS_device::time_until_ready()
+timestamp ADCS_device::get_polling_time()
 {
-	timestamp ret = 0;
-	timestamp current_time = sim->update_simulation();
-	timestamp difference = current_time - this->last_polled;
-
-	if (difference < this->min_polling_increment)
-	{
-		ret = this->min_polling_increment - difference;
-	}
+	return this->polling_time;
+}
 
-	return ret;
+timestamp ADCS_device::time_until_ready()
+{
+	return this->sim->device_time_until_ready(this->device_handle);
 }
 
 void ADCS_device::update_poll_time(timestamp new_time)
 {
-	this->last_polled = new_time;
+	this->sim->device_polled(this->device_handle, new_time);
 }
@@ -27,7 +27,7 @@ ADCS_timer::ADCS_timer(Simulator* sim)
 
 timestamp ADCS_timer::get_time()
 {
-    return this->sim->update_simulation();
+    return this->sim->update_simulation(ControllerCall::GetTime);
 }
 
 timestamp ADCS_timer::sleep(timestamp duration)
@@ -16,11 +16,25 @@
 
 measurement Accelerometer::take_measurement()
 {
-    if (this->time_until_ready() > 0)
+    device_result<measurement> result = this->try_take_measurement();
+    if (!result)
     {
         throw device_not_ready("Accelerometer not ready.");
     }
 
+    return result.value;
+}
+
+device_result<measurement> Accelerometer::try_take_measurement()
+{
+    device_result<measurement> result = {};
+    result.time_until_ready = this->time_until_ready();
+    if (result.time_until_ready > 0)
+    {
+        result.status = device_status::not_ready;
+        return result;
+    }
+
     Eigen::Vector3f measurement;
     measurement = Eigen::Vector3f::Zero();
 
@@ -30,5 +44,8 @@ measurement Accelerometer::take_measurement()
     this->current_vector_value.time_taken = current_time;
     this->current_vector_value.vec = measurement;
 
-    return this->current_vector_value;
+    result.value  = this->current_vector_value;
+    result.status = device_status::ok;
+
+    return result;
 }
@@ -52,6 +52,10 @@ float Actuator::get_max_acceleration() {
     return this->max_state_values.acceleration;
 }
 
+float Actuator::get_max_velocity() {
+    return this->max_state_values.velocity;
+}
+
 void Actuator::check_valid_state(actuator_state state)
 {
     if ( (this->max_state_values.acceleration < abs(state.acceleration)) ||
@@ -74,3 +78,14 @@ void Actuator::check_valid_state(actuator_state state)
 
     return;
 }
+
+bool Actuator::is_valid_state(actuator_state state)
+{
+    /* same checks as check_valid_state, so both always agree */
+    return !( (this->max_state_values.acceleration < abs(state.acceleration)) ||
+              (this->min_state_values.acceleration > abs(state.acceleration)) ||
+              (this->max_state_values.velocity     < abs(state.velocity))     ||
+              (this->min_state_values.velocity     > abs(state.velocity))     ||
+              (this->max_state_values.position     < abs(state.position))     ||
+              (this->min_state_values.position     > abs(state.position)) );
+}
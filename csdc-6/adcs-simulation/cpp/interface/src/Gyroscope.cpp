@@ -16,17 +16,32 @@
 
 gyro_state Gyroscope::take_measurement()
 {
-    if (this->time_until_ready() > 0)
+    device_result<gyro_state> result = this->try_take_measurement();
+    if (!result)
     {
         throw device_not_ready("Gyroscope not ready.");
     }
 
-    gyro_state measurement = this->sim->gyroscope_take_measurement();
-    this->update_poll_time(measurement.time_taken);
-
     /* commenting out for now, but may not need either of these lines. Leaving as comments until confirmed. */
     // this->current_vector_value.time_taken = current_time;
     // this->current_vector_value.vec = measurement;
 
-    return measurement;
+    return result.value;
+}
+
+device_result<gyro_state> Gyroscope::try_take_measurement()
+{
+    device_result<gyro_state> result = {};
+    result.time_until_ready = this->time_until_ready();
+    if (result.time_until_ready > 0)
+    {
+        result.status = device_status::not_ready;
+        return result;
+    }
+
+    result.value = this->sim->gyroscope_take_measurement();
+    this->update_poll_time(result.value.time_taken);
+    result.status = device_status::ok;
+
+    return result;
 }
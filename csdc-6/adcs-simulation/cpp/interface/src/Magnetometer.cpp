@@ -0,0 +1,49 @@
+/** 
+ * @file   Magnetometer.cpp
+ *
+ * @details This file implements the Magnetometer class as defined in sim_interface.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <Eigen/Dense>
+
+#include "sim_interface.hpp"
+
+measurement Magnetometer::take_measurement()
+{
+    device_result<measurement> result = this->try_take_measurement();
+    if (!result)
+    {
+        throw device_not_ready("Magnetometer not ready.");
+    }
+
+    return result.value;
+}
+
+device_result<measurement> Magnetometer::try_take_measurement()
+{
+    device_result<measurement> result = {};
+    result.time_until_ready = this->time_until_ready();
+    if (result.time_until_ready > 0)
+    {
+        result.status = device_status::not_ready;
+        return result;
+    }
+
+    Eigen::Vector3f measurement;
+    measurement = Eigen::Vector3f::Zero();
+
+    timestamp current_time = this->sim->magnetometer_take_measurement(&measurement);
+    this->update_poll_time(current_time);
+
+    this->current_vector_value.time_taken = current_time;
+    this->current_vector_value.vec = measurement;
+
+    result.value  = this->current_vector_value;
+    result.status = device_status::ok;
+
+    return result;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file    Magnetorquer.cpp
+ *
+ * @details This file implements the magnetorquer definition as defined in sim_interface.hpp.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <cmath>
+#include <Eigen/Dense>
+
+#include "sim_interface.hpp"
+#include "Simulator.hpp"
+
+Magnetorquer::Magnetorquer(timestamp polling_time, Simulator* sim, Eigen::Vector3f position, Eigen::Vector3f axis, float max_dipole, uint32_t handle) : Actuator(polling_time, sim, {position}, {}, {}, {}, axis)
+{
+    if (max_dipole <= 0)
+    {
+        throw invalid_adcs_param("Magnetorquer max dipole must be positive.");
+    }
+
+    this->max_dipole = max_dipole;
+    this->handle     = handle;
+
+    return;
+}
+
+float Magnetorquer::get_max_dipole()
+{
+    return this->max_dipole;
+}
+
+void Magnetorquer::set_dipole(float dipole)
+{
+    device_result<float> result = this->try_set_dipole(dipole);
+    if (device_status::invalid_state == result.status)
+    {
+        throw invalid_actuator_state("Magnetorquer dipole invalid.");
+    }
+    if (!result)
+    {
+        throw device_not_ready("Magnetorquer not ready.");
+    }
+
+    return;
+}
+
+device_result<float> Magnetorquer::try_set_dipole(float dipole)
+{
+    device_result<float> result = {};
+    if (std::abs(dipole) > this->max_dipole)
+    {
+        result.status = device_status::invalid_state;
+        return result;
+    }
+
+    result.time_until_ready = this->time_until_ready();
+    if (result.time_until_ready > 0)
+    {
+        result.status = device_status::not_ready;
+        return result;
+    }
+
+    timestamp cur_time = this->sim->magnetorquer_update_dipole(this->handle, dipole);
+    this->update_poll_time(cur_time);
+
+    result.value  = dipole;
+    result.status = device_status::ok;
+
+    return result;
+}
@@ -16,7 +16,7 @@
 #include "sim_interface.hpp"
 #include "Simulator.hpp"
 
-Reaction_wheel::Reaction_wheel(timestamp polling_time, Simulator* sim, Eigen::Vector3f position, actuator_state max_vals, actuator_state min_vals, actuator_state initial_vals, Eigen::Vector3f axis_of_rotation, float inertia_matrix) : Actuator(polling_time, sim, {position}, max_vals, min_vals, initial_vals, axis_of_rotation)
+Reaction_wheel::Reaction_wheel(timestamp polling_time, Simulator* sim, Eigen::Vector3f position, actuator_state max_vals, actuator_state min_vals, actuator_state initial_vals, Eigen::Vector3f axis_of_rotation, float inertia_matrix, uint32_t handle) : Actuator(polling_time, sim, {position}, max_vals, min_vals, initial_vals, axis_of_rotation)
 {
 
     if(inertia_matrix == 0)
@@ -25,6 +25,7 @@ Reaction_wheel::Reaction_wheel(timestamp polling_time, Simulator* sim, Eigen::Ve
     }
 
     this->inertia_matrix = inertia_matrix;
+    this->handle         = handle;
 
     return;
 }
@@ -38,20 +39,43 @@ void Reaction_wheel::set_target_state(actuator_state new_target)
 {
     check_valid_state(new_target);
 
-    if (this->time_until_ready() > 0)
+    if (!this->try_set_target_state(new_target))
     {
         throw device_not_ready("Reaction wheel not ready.");
     }
+
+    return;
+}
+
+device_result<actuator_state> Reaction_wheel::try_set_target_state(actuator_state new_target)
+{
+    device_result<actuator_state> result = {};
+    if (!this->is_valid_state(new_target))
+    {
+        result.status = device_status::invalid_state;
+        return result;
+    }
+
+    result.time_until_ready = this->time_until_ready();
+    if (result.time_until_ready > 0)
+    {
+        result.status = device_status::not_ready;
+        return result;
+    }
+
     this->target_state = new_target;
-    timestamp cur_time = this->sim->reaction_wheel_update_desired_state(this->position, this->target_state);
+    timestamp cur_time = this->sim->reaction_wheel_update_desired_state(this->handle, this->target_state);
     this->update_poll_time(cur_time);
 
-    return;
+    result.value  = this->target_state;
+    result.status = device_status::ok;
+
+    return result;
 }
 
 actuator_state Reaction_wheel::get_current_state()
 {
-    this->sim->reaction_wheel_get_current_state(this->position);
+    this->current_state = this->sim->reaction_wheel_get_current_state(this->handle);
     return this->current_state;
 }
 
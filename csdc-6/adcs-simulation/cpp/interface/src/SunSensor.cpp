@@ -0,0 +1,77 @@
+/** 
+ * @file   SunSensor.cpp
+ *
+ * @details This file implements the SunSensor class as defined in sim_interface.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <Eigen/Dense>
+
+#include "sim_interface.hpp"
+#include "Simulator.hpp"
+
+SunSensor::SunSensor(timestamp polling_time, Simulator* sim, Eigen::Vector3f position, Eigen::Vector3f axis, Eigen::Vector3f normal, float max_voltage, uint32_t handle) : Sensor(polling_time, sim, {position}, 1, 3)
+{
+    if (max_voltage <= 0)
+    {
+        throw invalid_adcs_param("Sun sensor max voltage must be positive.");
+    }
+
+    this->axis        = axis;
+    this->normal      = normal;
+    this->max_voltage = max_voltage;
+    this->handle      = handle;
+
+    return;
+}
+
+Eigen::Vector3f SunSensor::get_axis()
+{
+    return this->axis;
+}
+
+Eigen::Vector3f SunSensor::get_normal()
+{
+    return this->normal;
+}
+
+float SunSensor::get_max_voltage()
+{
+    return this->max_voltage;
+}
+
+sun_sensor_state SunSensor::take_measurement()
+{
+    device_result<sun_sensor_state> result = this->try_take_measurement();
+    if (!result)
+    {
+        throw device_not_ready("Sun sensor not ready.");
+    }
+
+    return result.value;
+}
+
+device_result<sun_sensor_state> SunSensor::try_take_measurement()
+{
+    device_result<sun_sensor_state> result = {};
+    result.time_until_ready = this->time_until_ready();
+    if (result.time_until_ready > 0)
+    {
+        result.status = device_status::not_ready;
+        return result;
+    }
+
+    Eigen::Vector4f voltage = Eigen::Vector4f::Zero();
+
+    timestamp current_time = this->sim->sun_sensor_take_measurement(this->handle, &voltage);
+    this->update_poll_time(current_time);
+
+    result.value.voltage    = voltage;
+    result.value.time_taken = current_time;
+    result.status           = device_status::ok;
+
+    return result;
+}
@@ -3,12 +3,33 @@
 import sys
 import os
 import re
+import struct
+import numpy as np
 import pandas as pd
 import matplotlib.pyplot as plt
 import webbrowser
 
+# binary telemetry header, see inc/TelemetryFormat.hpp
+TELEMETRY_MAGIC = b'ADCSTLM\0'
+TELEMETRY_HEADER = struct.Struct('=8sIIIII')
+
+def load_binary(bin_name):
+    with open(bin_name, 'rb') as f:
+        magic, version, byte_order, header_size, num_columns, num_wheels = TELEMETRY_HEADER.unpack(f.read(TELEMETRY_HEADER.size))
+        if magic != TELEMETRY_MAGIC or version != 1 or byte_order != 0x01020304:
+            raise ValueError(bin_name + " is not a binary telemetry file")
+        names = f.read(header_size - TELEMETRY_HEADER.size).split(b'\0')[:num_columns]
+
+    # the records are mapped rather than read, so only the plotted columns are loaded
+    records = np.memmap(bin_name, dtype=np.float32, mode='r', offset=header_size)
+    records = records[:len(records) - len(records) % num_columns].reshape(-1, num_columns)
+    return pd.DataFrame(records, columns=[name.decode() for name in names], copy=False)
+
 def plot_results(csv_name, outpath):
-    data = pd.read_csv(csv_name)
+    if csv_name.endswith('.bin'):
+        data = load_binary(csv_name)
+    else:
+        data = pd.read_csv(csv_name)
     time = data['Time']
 
     timestep = data['Timestep']*1000
@@ -97,7 +118,7 @@ def main():
     filepath = sys.argv[1]
     if (not os.path.exists('plots')):
         os.mkdir('plots')
-    filename = re.search('output/(.*).csv', filepath)
+    filename = re.search('output/(.*)\\.(csv|bin)', filepath)
     outpath = 'plots/' + filename.group(1)
     if (not os.path.exists(outpath)):
         os.mkdir(outpath)
@@ -0,0 +1,142 @@
+/**
+ * @file    AllocationCounter.cpp
+ *
+ * @details implements the allocation counter as defined in AllocationCounter.hpp
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+
+#include "AllocationCounter.hpp"
+
+namespace
+{
+    /* constant initialized, so they are valid for allocations made before main */
+    std::atomic<uint64_t> allocations(0);
+    std::atomic<uint64_t> deallocations(0);
+}
+
+#if defined(__GLIBC__)
+
+extern "C"
+{
+    void *__libc_malloc(size_t size);
+    void  __libc_free(void *ptr);
+    void *__libc_calloc(size_t count, size_t size);
+    void *__libc_realloc(void *ptr, size_t size);
+    void *__libc_memalign(size_t alignment, size_t size);
+    void *__libc_valloc(size_t size);
+    void *__libc_pvalloc(size_t size);
+
+    /**
+     * glibc allows malloc to be replaced by the executable. The replacements only count the calls
+     * and pass them on to glibc. The whole family is replaced, so aligned allocations (used by
+     * Eigen and aligned new) and frees are counted as well.
+    **/
+    void *malloc(size_t size)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_malloc(size);
+    }
+
+    void free(void *ptr)
+    {
+        if (nullptr != ptr)
+        {
+            deallocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        __libc_free(ptr);
+    }
+
+    void *calloc(size_t count, size_t size)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_calloc(count, size);
+    }
+
+    /* a realloc frees the old block and allocates a new one, unless it only does one of them */
+    void *realloc(void *ptr, size_t size)
+    {
+        if (nullptr != ptr)
+        {
+            deallocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        if ((nullptr == ptr) || (0 != size))
+        {
+            allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        return __libc_realloc(ptr, size);
+    }
+
+    void *memalign(size_t alignment, size_t size)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_memalign(alignment, size);
+    }
+
+    void *aligned_alloc(size_t alignment, size_t size)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void **ptr, size_t alignment, size_t size)
+    {
+        // the alignment must be a power of two multiple of the size of a pointer
+        if ((0 == alignment) || (0 != (alignment % sizeof(void *))) || (0 != (alignment & (alignment - 1))))
+        {
+            return EINVAL;
+        }
+
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        void *result = __libc_memalign(alignment, size);
+        if (nullptr == result)
+        {
+            return ENOMEM;
+        }
+
+        *ptr = result;
+        return 0;
+    }
+
+    void *valloc(size_t size)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_valloc(size);
+    }
+
+    void *pvalloc(size_t size)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_pvalloc(size);
+    }
+}
+
+bool AllocationCounter::is_supported()
+{
+    return true;
+}
+
+#else
+
+bool AllocationCounter::is_supported()
+{
+    return false;
+}
+
+#endif
+
+uint64_t AllocationCounter::get_allocations()
+{
+    return allocations.load(std::memory_order_relaxed);
+}
+
+uint64_t AllocationCounter::get_deallocations()
+{
+    return deallocations.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,321 @@
+/**
+ * @file    Campaign.cpp
+ *
+ * @details implements the Campaign and RunMonitor classes as defined in Campaign.hpp
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <thread>
+
+#include "Campaign.hpp"
+#include "DetumbleController.hpp"
+#include "DynamicsModel.hpp"
+#include "PointingModeController.hpp"
+#include "SensorActuatorFactory.hpp"
+#include "Simulator.hpp"
+
+RunMonitor::RunMonitor(Eigen::Vector3f desired_position, float required_accuracy, float detumble_rate)
+{
+    this->desired_attitude  = DynamicsModel::exp(desired_position);
+    this->required_accuracy = required_accuracy;
+    this->detumble_rate     = detumble_rate;
+    this->summary.completed     = true;
+    this->summary.detumble_time = -1;
+    this->silence_all();
+}
+
+void RunMonitor::update_simulation_state(const sim_config &state, timestamp time, timestamp timestep)
+{
+    (void)timestep;
+
+    float error = this->desired_attitude.angularDistance(state.satellite.attitude_b);
+    if (error > this->required_accuracy)
+    {
+        this->last_violation = time;
+    }
+
+    if (state.reaction_wheels.size() > 0)
+    {
+        this->summary.max_wheel_speed = std::max(this->summary.max_wheel_speed, state.reaction_wheels.omega.abs().maxCoeff());
+    }
+
+    // only the wheel momentum across the field can be dumped by magnetorquers
+    const Eigen::Vector3f &field = state.magnetometer.measurement;
+    if (field.squaredNorm() > 0)
+    {
+        const sim_wheel_bank &wheels = state.reaction_wheels;
+        const Eigen::Vector3f momentum = wheels.axis_of_rotation * (wheels.inertia * wheels.omega).matrix();
+        this->summary.final_cross_momentum = momentum.cross(field.normalized()).norm();
+        if (!this->field_measured)
+        {
+            this->summary.initial_cross_momentum = this->summary.final_cross_momentum;
+            this->field_measured = true;
+        }
+    }
+
+    this->summary.final_error = error;
+    this->summary.final_rate  = state.satellite.omega_b.norm();
+    // a run that starts below the detumble rate is detumbled from the start
+    if ((this->summary.detumble_time < 0) && (this->summary.final_rate < this->detumble_rate))
+    {
+        this->summary.detumble_time = (0 == this->summary.steps) ? 0 : (float)time;
+    }
+    this->summary.settle_time = (error > this->required_accuracy) ? -1 : (float)this->last_violation;
+    this->summary.steps++;
+
+    return;
+}
+
+run_summary RunMonitor::get_summary()
+{
+    return this->summary;
+}
+
+Campaign::Campaign(const Configuration &base, campaign_config settings) : base(base), settings(settings)
+{
+    if (0 == this->settings.threads)
+    {
+        this->settings.threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+bool Campaign::load(const std::string &fileName, campaign_config *settings)
+{
+    YAML::Node top;
+
+    //load the yaml campaign file
+    try {
+        top = YAML::LoadFile(fileName);
+    } catch (YAML::Exception &e) {
+        std::cout << "YAML File Load failure for file: " << fileName << " : " << e.what() << std::endl;
+        return false;
+    }
+
+    try {
+        settings->runs    = top["Runs"].as<uint32_t>();
+        settings->threads = top["Threads"] ? top["Threads"].as<uint32_t>() : 0;
+        settings->seed    = top["Seed"]    ? top["Seed"].as<uint32_t>()    : 0;
+
+        YAML::Node perturbations = top["Perturbations"];
+        settings->inertia          = perturbations["Inertia"]         ? perturbations["Inertia"].as<float>()         : 0;
+        settings->initial_velocity = perturbations["InitialVelocity"] ? perturbations["InitialVelocity"].as<float>() : 0;
+        settings->wheel_inertia    = perturbations["WheelInertia"]    ? perturbations["WheelInertia"].as<float>()    : 0;
+        settings->polling_time     = perturbations["PollingTime"]     ? perturbations["PollingTime"].as<float>()     : 0;
+    } catch (YAML::Exception &e) {
+        std::cout << "YAML ERROR ON CAMPAIGN: " << e.what() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+std::vector<run_summary> Campaign::run()
+{
+    std::vector<run_summary> results(this->settings.runs);
+    std::atomic<uint32_t> next_run(0);
+
+    // each thread takes the next run that has not been started until all are done
+    auto worker = [&]()
+    {
+        for (uint32_t run = next_run++; run < this->settings.runs; run = next_run++)
+        {
+            Configuration config = this->perturb(run);
+            results[run] = run_single(config, run);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (uint32_t i = 0; i < std::min(this->settings.threads, this->settings.runs); i++)
+    {
+        workers.emplace_back(worker);
+    }
+
+    for (std::thread &thread : workers)
+    {
+        thread.join();
+    }
+
+    return results;
+}
+
+run_summary Campaign::run_single(Configuration &config, uint32_t run)
+{
+    using namespace std::chrono;
+    steady_clock::time_point start = steady_clock::now();
+
+    // the detumble time is only recorded when detumbling, pointing runs start at a low rate
+    const bool detumbling = (ControlMode::Detumble == config.getControlMode());
+    RunMonitor monitor(config.getDesiredSatellitePosition(), config.getRequiredAccuracy() * M_PI / 180,
+                       detumbling ? config.getDetumbleRate() : 0);
+    bool completed = true;
+    uint32_t rejected_commands = 0;
+
+    try
+    {
+        Simulator simulator(&monitor);
+        simulator.init(config);
+
+        std::unordered_map<std::string, std::shared_ptr<Sensor>> sensors;
+        std::unordered_map<std::string, std::shared_ptr<Actuator>> actuators;
+
+        for (const auto &sensor : config.GetSensorConfigs())
+        {
+            sensors[sensor.first] = SensorActuatorFactory::GetSensor(config, sensor.first, &simulator);
+        }
+
+        for (const auto &actuator : config.GetActuatorConfigs())
+        {
+            actuators[actuator.first] = SensorActuatorFactory::GetActuator(config, actuator.first, &simulator);
+        }
+
+        ADCS_timer timer(&simulator);
+
+        // every run ends with its timeout
+        if (detumbling)
+        {
+            DetumbleController controller(sensors, actuators, &timer);
+            try
+            {
+                controller.begin(config.getDetumbleRate());
+            }
+            catch (simulation_timeout &e) {}
+            rejected_commands = controller.get_rejected_commands();
+        }
+        else
+        {
+            PointingModeController controller(sensors, actuators, &timer);
+            controller.set_field_reference(SensorActuatorFactory::GetFieldReference(config));
+            try
+            {
+                controller.begin(config.getDesiredSatellitePosition(), ramp_time);
+            }
+            catch (simulation_timeout &e) {}
+            rejected_commands = controller.get_rejected_commands();
+        }
+    }
+    catch (adcs_exception &e)
+    {
+        completed = false;
+    }
+
+    run_summary summary = monitor.get_summary();
+    summary.run       = run;
+    summary.completed = completed;
+    summary.rejected_commands = rejected_commands;
+    summary.wall_time = duration_cast<microseconds>(steady_clock::now() - start).count() / 1000.0f;
+
+    return summary;
+}
+
+Configuration Campaign::perturb(uint32_t run) const
+{
+    Configuration config = this->base;
+
+    // the sensor noise of each run is its own stream, keyed by the campaign seed and run number
+    config.SetNoiseSeed((static_cast<uint64_t>(this->settings.seed) << 32) | run);
+
+    // seeded from the run number so every run is the same regardless of which thread runs it
+    std::seed_seq seed = {this->settings.seed, run};
+    std::mt19937 generator(seed);
+    std::normal_distribution<float> normal(0, 1);
+    std::uniform_real_distribution<float> uniform(-1, 1);
+
+    // the principal moments are perturbed about the principal axes, so the tensor stays symmetric
+    // and positive definite however large the perturbation is
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3f> principal(config.GetSatelliteMoment());
+    Eigen::Vector3f moments = principal.eigenvalues();
+    for (int i = 0; i < 3; i++)
+    {
+        moments(i) *= std::max(0.01f, 1 + this->settings.inertia * normal(generator));
+    }
+    config.SetSatelliteMoment(principal.eigenvectors() * moments.asDiagonal() * principal.eigenvectors().transpose());
+
+    Eigen::Vector3f velocity = config.GetSatelliteVelocity();
+    for (int i = 0; i < 3; i++)
+    {
+        velocity(i) += this->settings.initial_velocity * normal(generator);
+    }
+    config.SetSatelliteVelocity(velocity);
+
+    // the configs are shared with the base, so each one is replaced with a perturbed copy
+    const auto sensors   = config.GetSensorConfigs();
+    const auto actuators = config.GetActuatorConfigs();
+
+    for (const auto &sensor : sensors)
+    {
+        std::shared_ptr<SensorConfig> perturbed;
+        switch (sensor.second->type)
+        {
+            case SensorType::Gyroscope:
+                perturbed = std::make_shared<GyroConfig>(static_cast<const GyroConfig &>(*sensor.second));
+                break;
+            case SensorType::Accelerometer:
+                perturbed = std::make_shared<AccelerometerConfig>(static_cast<const AccelerometerConfig &>(*sensor.second));
+                break;
+            case SensorType::Magnetometer:
+                perturbed = std::make_shared<MagnetometerConfig>(static_cast<const MagnetometerConfig &>(*sensor.second));
+                break;
+            case SensorType::SunSensor:
+                perturbed = std::make_shared<SunSensorConfig>(static_cast<const SunSensorConfig &>(*sensor.second));
+                break;
+        }
+
+        perturbed->pollingTime = std::max(1, perturbed->pollingTime + (int)std::lround(this->settings.polling_time * uniform(generator)));
+        config.SetSensorConfig(sensor.first, perturbed);
+    }
+
+    for (const auto &actuator : actuators)
+    {
+        switch (actuator.second->type)
+        {
+            case ActuatorType::ReactionWheel:
+            {
+                auto perturbed = std::make_shared<ReactionWheelConfig>(static_cast<const ReactionWheelConfig &>(*actuator.second));
+                perturbed->momentOfInertia *= std::max(0.01f, 1 + this->settings.wheel_inertia * normal(generator));
+                perturbed->pollingTime      = std::max(1.0f, perturbed->pollingTime + std::round(this->settings.polling_time * uniform(generator)));
+                config.SetActuatorConfig(actuator.first, perturbed);
+                break;
+            }
+            case ActuatorType::Magnetorquer:
+            {
+                auto perturbed = std::make_shared<MagnetorquerConfig>(static_cast<const MagnetorquerConfig &>(*actuator.second));
+                perturbed->pollingTime = std::max(1.0f, perturbed->pollingTime + std::round(this->settings.polling_time * uniform(generator)));
+                config.SetActuatorConfig(actuator.first, perturbed);
+                break;
+            }
+        }
+    }
+
+    return config;
+}
+
+void Campaign::write_summary(const std::vector<run_summary> &results, const std::string &path)
+{
+    std::ofstream output_file(path);
+    if (!output_file.is_open())
+    {
+        throw campaign_failure("Unable to open the campaign output file.");
+    }
+
+    output_file << "Run,Completed,Final error,Settle time,Final rate,Max wheel speed,Initial cross-field momentum,"
+                << "Final cross-field momentum,Detumble time,Rejected commands,Steps,Wall time" << std::endl;
+    for (const run_summary &summary : results)
+    {
+        output_file << summary.run << "," << summary.completed << "," << summary.final_error << "," << summary.settle_time << ","
+                    << summary.final_rate << "," << summary.max_wheel_speed << "," << summary.initial_cross_momentum << ","
+                    << summary.final_cross_momentum << "," << summary.detumble_time << ","
+                    << summary.rejected_commands << "," << summary.steps << "," << summary.wall_time << std::endl;
+    }
+
+    return;
+}
@@ -11,6 +11,7 @@
 **/
 
 #include "ConfigurationSingleton.hpp"
+#include "SunSensorCalibration.hpp"
 #include <iostream>
 
 ReactionWheelConfig::ReactionWheelConfig(const YAML::Node &node) : ActuatorConfig(ActuatorType::ReactionWheel) {
@@ -34,6 +35,62 @@ ReactionWheelConfig::ReactionWheelConfig(const YAML::Node &node) : ActuatorConfi
     }
     velocity = node["Velocity"].as<float>();
     acceleration = node["Acceleration"].as<float>();
+
+    motorTimeConstant = node["MotorTimeConstant"] ? node["MotorTimeConstant"].as<float>() : 0;
+    coulombFriction   = node["CoulombFriction"]   ? node["CoulombFriction"].as<float>()   : 0;
+    viscousFriction   = node["ViscousFriction"]   ? node["ViscousFriction"].as<float>()   : 0;
+}
+
+MagnetorquerConfig::MagnetorquerConfig(const YAML::Node &node) : ActuatorConfig(ActuatorType::Magnetorquer) {
+    maxDipole = node["MaxDipole"].as<float>();
+    pollingTime = node["PollingTime"].as<float>();
+
+    int i = 0;
+    for (const auto &n : node["Position"]) {
+        position(i++) = n.as<float>();
+    }
+
+    i = 0;
+    for (const auto &n : node["Axis"]) {
+        axis(i++) = n.as<float>();
+    }
+}
+
+SunSensorConfig::SunSensorConfig(const YAML::Node &node) : SensorConfig(SensorType::SunSensor, node) {
+    axis = Eigen::Vector3f::UnitX();
+    normal = Eigen::Vector3f::UnitZ();
+    maxVoltage = node["MaxVoltage"] ? node["MaxVoltage"].as<float>() : sun_sensor_calibration::max_voltage;
+
+    int i = 0;
+    for (const auto &n : node["Axis"]) {
+        axis(i++) = n.as<float>();
+    }
+
+    i = 0;
+    for (const auto &n : node["Normal"]) {
+        normal(i++) = n.as<float>();
+    }
+}
+
+sensor_noise SensorConfig::LoadNoise(const YAML::Node &node) {
+    sensor_noise noise;
+    noise.white_noise      = node["WhiteNoise"]     ? node["WhiteNoise"].as<float>()     : 0;
+    noise.bias_random_walk = node["BiasRandomWalk"] ? node["BiasRandomWalk"].as<float>() : 0;
+    noise.initial_bias     = node["InitialBias"]    ? node["InitialBias"].as<float>()    : 0;
+    noise.quantization     = node["Quantization"]   ? node["Quantization"].as<float>()   : 0;
+    noise.attitude_noise   = node["AttitudeNoise"]  ? node["AttitudeNoise"].as<float>()  : 0;
+
+    int i = 0;
+    for (const auto &n : node["ScaleFactor"]) {
+        noise.scale_factor(i++) = n.as<float>();
+    }
+
+    i = 0;
+    for (const auto &n : node["Misalignment"]) {
+        noise.misalignment(i++) = n.as<float>();
+    }
+
+    return noise;
 }
 
 bool Configuration::Load(const std::string &configFile) {
@@ -84,9 +141,9 @@ bool Configuration::Load(const std::string &configFile) {
     //load max and min timestep
         try {
             YAML::Node max = top["TimeStepMax"];
-            timeStepMax = max.as<int>();
+            timeStepMax = max.as<float>();
             YAML::Node min = top["TimeStepMin"];
-            timeStepMin = min.as<int>();
+            timeStepMin = min.as<float>();
         } catch (YAML::Exception &e){
             std::cout << "YAML ERROR ON TIMESTEP BOUNDS: " << e.what() <<std::endl;
         }
@@ -110,7 +167,137 @@ bool Configuration::Load(const std::string &configFile) {
         std::cout << "YAML ERROR ON TIMEOUT: " << e.what() <<std::endl;
     }
 
-    //load sensors
+    //load time mode, defaults to virtual time with no controller cost
+    timeMode = TimeMode::Virtual;
+    controllerCostsInMilliseconds.fill(0);
+    try {
+        YAML::Node mode = top["TimeMode"];
+        if (mode) {
+            const std::string modeName = mode.as<std::string>();
+            if (modeName == "RealTime") {
+                timeMode = TimeMode::RealTime;
+            } else if (modeName != "Virtual") {
+                std::cout << "Unknown time mode: " << modeName << ", using Virtual" << std::endl;
+            }
+        }
+
+        YAML::Node cost = top["ControllerCost"];
+        if (cost && cost.IsScalar()) {
+            controllerCostsInMilliseconds.fill(cost.as<float>());
+        } else if (cost && cost.IsMap()) {
+            const std::unordered_map<std::string, ControllerCall> callNames = {
+                {"GetTime",                  ControllerCall::GetTime},
+                {"Sleep",                    ControllerCall::Sleep},
+                {"DeviceReady",              ControllerCall::DeviceReady},
+                {"GyroscopeMeasurement",     ControllerCall::GyroscopeMeasurement},
+                {"AccelerometerMeasurement", ControllerCall::AccelerometerMeasurement},
+                {"MagnetometerMeasurement",  ControllerCall::MagnetometerMeasurement},
+                {"SunSensorMeasurement",     ControllerCall::SunSensorMeasurement},
+                {"ReactionWheelCommand",     ControllerCall::ReactionWheelCommand},
+                {"ReactionWheelState",       ControllerCall::ReactionWheelState},
+                {"MagnetorquerCommand",      ControllerCall::MagnetorquerCommand}
+            };
+            for (const auto &n : cost) {
+                const std::string callName = n.first.as<std::string>();
+                if (callNames.count(callName)) {
+                    controllerCostsInMilliseconds[static_cast<size_t>(callNames.at(callName))] = n.second.as<float>();
+                } else {
+                    std::cout << "Unknown controller call: " << callName << std::endl;
+                }
+            }
+        }
+    } catch (YAML::Exception &e){
+        std::cout << "YAML ERROR ON TIME MODE: " << e.what() <<std::endl;
+    }
+
+    //load integrator, defaults to Euler
+    integratorType = IntegratorType::Euler;
+    try {
+        YAML::Node integrator = top["Integrator"];
+        if (integrator) {
+            const std::string integratorName = integrator.as<std::string>();
+            if (integratorName == "RK4") {
+                integratorType = IntegratorType::RK4;
+            } else if (integratorName == "RK45") {
+                integratorType = IntegratorType::RK45;
+            } else if (integratorName != "Euler") {
+                std::cout << "Unknown integrator: " << integratorName << ", using Euler" << std::endl;
+            }
+        }
+    } catch (YAML::Exception &e){
+        std::cout << "YAML ERROR ON INTEGRATOR: " << e.what() <<std::endl;
+    }
+
+    //load the orbit, which is not modelled unless given
+    orbit = sim_orbit();
+    try {
+        YAML::Node orbitYaml = top["Orbit"];
+        if (orbitYaml) {
+            const YAML::Node tle = orbitYaml["TLE"];
+            orbit.elements   = SGP4::parse_tle(tle[0].as<std::string>(), tle[1].as<std::string>());
+            orbit.start_time = orbitYaml["StartTime"] ? orbitYaml["StartTime"].as<double>() : 0;
+            orbit.enabled    = true;
+        }
+    } catch (YAML::Exception &e){
+        std::cout << "YAML ERROR ON ORBIT: " << e.what() <<std::endl;
+    } catch (invalid_tle &e){
+        std::cout << "INVALID TLE: " << e.what() <<std::endl;
+    }
+
+    //load the disturbance torques, none are modelled unless given
+    disturbances = sim_disturbances();
+    try {
+        YAML::Node disturbancesYaml = top["Disturbances"];
+        if (disturbancesYaml) {
+            if (disturbancesYaml["UpdatePeriod"]) {
+                disturbances.update_period = disturbancesYaml["UpdatePeriod"].as<float>() / 1000.0f;
+            }
+            if (disturbancesYaml["GravityGradient"]) {
+                disturbances.gravity_gradient = disturbancesYaml["GravityGradient"].as<bool>();
+            }
+
+            const YAML::Node aerodynamic = disturbancesYaml["Aerodynamic"];
+            if (aerodynamic) {
+                disturbances.drag_area = aerodynamic["Area"].as<float>();
+                if (aerodynamic["DragCoefficient"]) {
+                    disturbances.drag_coefficient = aerodynamic["DragCoefficient"].as<float>();
+                }
+                int i = 0;
+                for (const auto &n : aerodynamic["CenterOfPressure"]) {
+                    disturbances.drag_center(i++) = n.as<float>();
+                }
+            }
+
+            const YAML::Node solar = disturbancesYaml["SolarPressure"];
+            if (solar) {
+                disturbances.solar_area = solar["Area"].as<float>();
+                if (solar["Reflectivity"]) {
+                    disturbances.solar_reflectivity = solar["Reflectivity"].as<float>();
+                }
+                int i = 0;
+                for (const auto &n : solar["CenterOfPressure"]) {
+                    disturbances.solar_center(i++) = n.as<float>();
+                }
+            }
+
+            int i = 0;
+            for (const auto &n : disturbancesYaml["ResidualDipole"]) {
+                disturbances.residual_dipole(i++) = n.as<float>();
+            }
+        }
+    } catch (YAML::Exception &e){
+        std::cout << "YAML ERROR ON DISTURBANCES: " << e.what() <<std::endl;
+    }
+
+    //load the seed of the sensor noise, defaults to 0
+    try {
+        noiseSeed = top["NoiseSeed"] ? top["NoiseSeed"].as<uint64_t>() : 0;
+    } catch (YAML::Exception &e){
+        std::cout << "YAML ERROR ON NOISE SEED: " << e.what() <<std::endl;
+    }
+
+    //load sensors, dropping those of any previous config
+    sensorConfigs.clear();
     try {
         YAML::Node sensors = top["Sensors"];
         for (const auto &n : sensors) {
@@ -119,6 +306,10 @@ bool Configuration::Load(const std::string &configFile) {
                 sensorConfigs[n.first.as<std::string>()] = std::make_shared<GyroConfig>(n.second);
             } else if (type == "Accelerometer") {
                 sensorConfigs[n.first.as<std::string>()] = std::make_shared<AccelerometerConfig>(n.second);
+            } else if (type == "Magnetometer") {
+                sensorConfigs[n.first.as<std::string>()] = std::make_shared<MagnetometerConfig>(n.second);
+            } else if (type == "SunSensor") {
+                sensorConfigs[n.first.as<std::string>()] = std::make_shared<SunSensorConfig>(n.second);
             } else {
                 std::cout << "Error unknown sensor type: " << type << std::endl;
             }
@@ -127,13 +318,16 @@ bool Configuration::Load(const std::string &configFile) {
         std::cout << "YAML ERROR ON SENSORS: " << e.what() << std::endl;
     }
 
-    //load actuators
+    //load actuators, dropping those of any previous config
+    actuatorConfigs.clear();
     try {
         YAML::Node actuatorsYaml = top["Actuators"];
         for (const auto &n : actuatorsYaml) {
             const std::string type = n.second["type"].as<std::string>();
             if (type == "ReactionWheel") {
                 actuatorConfigs[n.first.as<std::string>()] = std::make_shared<ReactionWheelConfig>(n.second);
+            } else if (type == "Magnetorquer") {
+                actuatorConfigs[n.first.as<std::string>()] = std::make_shared<MagnetorquerConfig>(n.second);
             } else {
                 std::cout << "Unkown actuator type: " << type << std::endl;
             }
@@ -215,5 +409,30 @@ bool Configuration::load_exit_file(const std::string &fileName)
         std::cout << "YAML ERROR ON HoldTime: " << e.what() <<std::endl;
     }
 
+    /* get the mode of the control code, and the rate it counts as detumbled below */
+    try
+    {
+        control_mode = ControlMode::Pointing;
+        YAML::Node mode = top["Mode"];
+        if (mode && (mode.as<std::string>() == "Detumble"))
+        {
+            control_mode = ControlMode::Detumble;
+        }
+        else if (mode && (mode.as<std::string>() != "Pointing"))
+        {
+            std::cout << "Unknown mode: " << mode.as<std::string>() << ", using Pointing" << std::endl;
+        }
+
+        YAML::Node rate = top["DetumbleRate"];
+        if (rate)
+        {
+            this->detumble_rate = rate.as<float>();
+        }
+    }
+    catch (YAML::Exception &e)
+    {
+        std::cout << "YAML ERROR ON Mode: " << e.what() <<std::endl;
+    }
+
     return true;
 }
@@ -0,0 +1,166 @@
+/**
+ * @file    DisturbanceModel.cpp
+ *
+ * @details implements the disturbance torques as defined in DisturbanceModel.hpp.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <algorithm>
+
+#include "DisturbanceModel.hpp"
+#include "Environment.hpp"
+
+Eigen::Vector3f GravityGradientModel::torque(const environment_sample &environment, const Eigen::Quaternionf &attitude,
+                                             const Eigen::Matrix3f &inertia) const
+{
+    // mu / r^3 has units of 1/s^2, so the position can stay in km
+    const float radius = environment.position.norm();
+    const float rate   = static_cast<float>(Environment::earth_mu) / (radius * radius * radius);
+    const Eigen::Vector3f nadir = attitude.conjugate() * (environment.position / radius);
+
+    return 3 * rate * nadir.cross(inertia * nadir);
+}
+
+AerodynamicModel::AerodynamicModel(float area, float drag_coefficient, const Eigen::Vector3f &center)
+{
+    this->drag_area = 0.5f * drag_coefficient * area;
+    this->center    = center;
+}
+
+Eigen::Vector3f AerodynamicModel::torque(const environment_sample &environment, const Eigen::Quaternionf &attitude,
+                                         const Eigen::Matrix3f &inertia) const
+{
+    (void) inertia;
+
+    const Eigen::Vector3f velocity = attitude.conjugate() * environment.air_velocity;
+    const Eigen::Vector3f force    = -this->drag_area * environment.density * velocity.norm() * velocity;
+
+    return this->center.cross(force);
+}
+
+SolarPressureModel::SolarPressureModel(float area, float reflectivity, const Eigen::Vector3f &center)
+{
+    this->force  = static_cast<float>(Environment::solar_pressure) * area * (1 + reflectivity);
+    this->center = center;
+}
+
+Eigen::Vector3f SolarPressureModel::torque(const environment_sample &environment, const Eigen::Quaternionf &attitude,
+                                           const Eigen::Matrix3f &inertia) const
+{
+    (void) inertia;
+
+    // the light pushes the satellite away from the sun
+    const Eigen::Vector3f sun = attitude.conjugate() * environment.sun_direction;
+
+    return this->center.cross(-this->force * environment.sunlight * sun);
+}
+
+ResidualDipoleModel::ResidualDipoleModel(const Eigen::Vector3f &dipole)
+{
+    this->dipole = dipole;
+}
+
+Eigen::Vector3f ResidualDipoleModel::torque(const environment_sample &environment, const Eigen::Quaternionf &attitude,
+                                            const Eigen::Matrix3f &inertia) const
+{
+    (void) inertia;
+
+    return this->dipole.cross(attitude.conjugate() * environment.magnetic_field);
+}
+
+DisturbanceTorques::DisturbanceTorques(const sim_disturbances &config, const sim_orbit &orbit) :
+    orbit_model(orbit.elements)
+{
+    this->start_time    = orbit.start_time;
+    this->update_period = std::max(timestamp(config.update_period), timestamp(1, 0));
+
+    if (config.gravity_gradient)
+    {
+        this->models.push_back(std::make_unique<GravityGradientModel>());
+    }
+    if (config.drag_area > 0)
+    {
+        this->models.push_back(std::make_unique<AerodynamicModel>(config.drag_area, config.drag_coefficient,
+                                                                  config.drag_center));
+    }
+    if (config.solar_area > 0)
+    {
+        this->models.push_back(std::make_unique<SolarPressureModel>(config.solar_area, config.solar_reflectivity,
+                                                                    config.solar_center));
+    }
+    if (!config.residual_dipole.isZero())
+    {
+        this->models.push_back(std::make_unique<ResidualDipoleModel>(config.residual_dipole));
+    }
+}
+
+Eigen::Vector3f DisturbanceTorques::torque(timestamp time, const Eigen::Quaternionf &attitude,
+                                           const Eigen::Matrix3f &inertia)
+{
+    if (this->models.empty())
+    {
+        return Eigen::Vector3f::Zero();
+    }
+
+    // move to the next interval, reusing the sample at its start when the time has just crossed it
+    if (!this->sampled || (time < this->previous_time) || (time >= this->next_time))
+    {
+        if (this->sampled && (time >= this->next_time) && (time < this->next_time + this->update_period))
+        {
+            this->previous      = this->next;
+            this->previous_time = this->next_time;
+        }
+        else
+        {
+            this->previous      = this->sample(time);
+            this->previous_time = time;
+        }
+
+        this->next_time = this->previous_time + this->update_period;
+        this->next      = this->sample(this->next_time);
+        this->sampled   = true;
+    }
+
+    const float fraction = static_cast<float>(time - this->previous_time) / static_cast<float>(this->update_period);
+
+    environment_sample environment;
+    environment.position       = (1 - fraction) * this->previous.position       + fraction * this->next.position;
+    environment.air_velocity   = (1 - fraction) * this->previous.air_velocity   + fraction * this->next.air_velocity;
+    environment.sun_direction  = (1 - fraction) * this->previous.sun_direction  + fraction * this->next.sun_direction;
+    environment.sunlight       = (1 - fraction) * this->previous.sunlight       + fraction * this->next.sunlight;
+    environment.magnetic_field = (1 - fraction) * this->previous.magnetic_field + fraction * this->next.magnetic_field;
+    environment.density        = (1 - fraction) * this->previous.density        + fraction * this->next.density;
+
+    Eigen::Vector3f total = Eigen::Vector3f::Zero();
+    for (const auto &model : this->models)
+    {
+        total += model->torque(environment, attitude, inertia);
+    }
+
+    return total;
+}
+
+environment_sample DisturbanceTorques::sample(timestamp time)
+{
+    const double minutes     = this->start_time + time.microseconds() / 60.0e6;
+    const double julian_date = this->orbit_model.get_elements().epoch + minutes / 1440.0;
+
+    Eigen::Vector3d position;
+    Eigen::Vector3d velocity;
+    this->orbit_model.propagate(minutes, position, velocity);
+
+    const Eigen::Vector3d sun = Environment::sun_position(julian_date);
+
+    environment_sample environment;
+    environment.position       = position.cast<float>();
+    environment.air_velocity   = (1000 * Environment::atmosphere_velocity(position, velocity)).cast<float>();
+    environment.sun_direction  = (sun - position).normalized().cast<float>();
+    environment.sunlight       = Environment::in_shadow(position, sun) ? 0.0f : 1.0f;
+    environment.magnetic_field = this->magnetic_field.field(position, julian_date).cast<float>();
+    environment.density        = static_cast<float>(Environment::atmosphere_density(position));
+
+    return environment;
+}
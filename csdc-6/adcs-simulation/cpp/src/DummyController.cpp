@@ -27,9 +27,10 @@ void DummyController::begin()
 {
     timestamp time;
 
+    /* nothing needs to be polled, so sleep until the timeout in as few calls as possible */
     while(this->timeout > time)
     {
-        timer->sleep(timestamp(0,1));
+        time = timer->sleep(this->timeout - time);
     }
 
     return;
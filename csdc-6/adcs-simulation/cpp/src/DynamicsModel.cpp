@@ -0,0 +1,112 @@
+/**
+ * @file    DynamicsModel.cpp
+ *
+ * @details implements the DynamicsModel class as defined in DynamicsModel.hpp
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <cmath>
+
+#include "DynamicsModel.hpp"
+
+DynamicsModel::DynamicsModel(const sim_config &system)
+{
+    const sim_wheel_bank &wheels = system.reaction_wheels;
+
+    this->inertia_b         = system.satellite.inertia_b;
+    this->inertia_b_inverse = system.satellite.inertia_b.inverse();
+
+    // This assumes that I_rw is a scalar, and can thus be multiplied by the axis of rotation to achieve the right matrix dimensions
+    // change this if I_rw becomes a matrix!
+    this->wheel_axes       = wheels.axis_of_rotation * wheels.inertia.matrix().asDiagonal();
+    this->wheel_max_omega  = wheels.max_omega;
+    this->wheel_motor_rate = (wheels.time_constant > 0).select(wheels.time_constant.inverse(), 0);
+    this->wheel_coulomb    = wheels.coulomb_friction / wheels.inertia;
+    this->wheel_viscous    = wheels.viscous_friction / wheels.inertia;
+
+    this->set_wheel_commands(wheels);
+}
+
+void DynamicsModel::set_wheel_commands(const sim_wheel_bank &reaction_wheels)
+{
+    this->wheel_command = reaction_wheels.command;
+
+    return;
+}
+
+void DynamicsModel::set_wheel_command(uint32_t index, float command)
+{
+    this->wheel_command(index) = command;
+
+    return;
+}
+
+void DynamicsModel::set_external_torque(const Eigen::Vector3f &torque)
+{
+    this->external_torque = torque;
+
+    return;
+}
+
+void DynamicsModel::calculate_derivative(const Eigen::VectorXf &state, Eigen::VectorXf &derivative) const
+{
+    const Eigen::Index num_wheels = this->wheel_command.size();
+    const Eigen::Vector3f omega_b = state.head<3>();
+    const auto omega_rw = state.segment(6, num_wheels).array();
+    const auto drive_rw = state.tail(num_wheels).array();
+
+    // the drive tapers off as a wheel nears its maximum speed if it would drive the wheel faster,
+    // and the friction always acts against the spin of the wheel
+    const auto taper = ((this->wheel_max_omega - omega_rw.abs()) / saturation_speed_band).min(1.0f).max(0.0f);
+    derivative.segment(6, num_wheels).array() =
+        (drive_rw * omega_rw > 0).select(taper * drive_rw, drive_rw)
+        - this->wheel_coulomb * (omega_rw / coulomb_speed_band).tanh()
+        - this->wheel_viscous * omega_rw;
+    derivative.tail(num_wheels).array() = this->wheel_motor_rate * (this->wheel_command - drive_rw);
+
+    // sum over all wheels of I_rw * alpha_rw * axis + omega_b x (I_rw * omega_rw * axis)
+    Eigen::Vector3f sum_rw = this->wheel_axes * derivative.segment(6, num_wheels)
+        + omega_b.cross(this->wheel_axes * state.segment(6, num_wheels));
+
+    derivative.head<3>() = (-this->inertia_b_inverse * omega_b).cross(this->inertia_b * omega_b)
+        + this->inertia_b_inverse * (this->external_torque - sum_rw);
+    derivative.segment<3>(3) = dexp_inverse(state.segment<3>(3), omega_b);
+
+    return;
+}
+
+Eigen::Quaternionf DynamicsModel::exp(const Eigen::Vector3f &rotation)
+{
+    const float angle = rotation.norm();
+    if (0 == angle)
+    {
+        return Eigen::Quaternionf::Identity();
+    }
+
+    return Eigen::Quaternionf(Eigen::AngleAxisf(angle, rotation / angle));
+}
+
+Eigen::Vector3f DynamicsModel::log(const Eigen::Quaternionf &attitude)
+{
+    Eigen::AngleAxisf rotation(attitude);
+
+    return rotation.angle() * rotation.axis();
+}
+
+Eigen::Vector3f DynamicsModel::dexp_inverse(const Eigen::Vector3f &rotation, const Eigen::Vector3f &omega)
+{
+    const float angle = rotation.norm();
+    const Eigen::Vector3f rotation_cross_omega = rotation.cross(omega);
+
+    // coefficient is (1 - (angle/2) * cot(angle/2)) / angle^2, which tends to 1/12 for small angles
+    float coefficient = 1.0f / 12 + angle * angle / 720;
+    if (angle > 0.001f)
+    {
+        coefficient = (1 - (angle / 2) / std::tan(angle / 2)) / (angle * angle);
+    }
+
+    return omega - 0.5f * rotation_cross_omega + coefficient * rotation.cross(rotation_cross_omega);
+}
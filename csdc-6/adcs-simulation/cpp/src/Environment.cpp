@@ -0,0 +1,110 @@
+/**
+ * @file    Environment.cpp
+ *
+ * @details implements the environment models as defined in Environment.hpp. The sun, sidereal
+ *          time and atmosphere models follow Vallado, Fundamentals of Astrodynamics and
+ *          Applications.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "Environment.hpp"
+
+namespace
+{
+    constexpr double deg_2_rad = M_PI / 180;
+    constexpr double j2000     = 2451545.0;
+
+    /**
+     * @struct  density_layer
+     *
+     * @details one layer of the exponential atmosphere.
+     *
+     * @param base_altitude  altitude at the bottom of the layer, in km.
+     * @param base_density   density at the bottom of the layer, in kg/m^3.
+     * @param scale_height   altitude the density falls by a factor of e over, in km.
+    **/
+    typedef struct
+    {
+        double base_altitude;
+        double base_density;
+        double scale_height;
+    } density_layer;
+
+    constexpr std::array<density_layer, 28> density_layers = {{
+        {    0, 1.225,     7.249  }, {   25, 3.899e-2,  6.349  }, {   30, 1.774e-2,  6.682  },
+        {   40, 3.972e-3,  7.554  }, {   50, 1.057e-3,  8.382  }, {   60, 3.206e-4,  7.714  },
+        {   70, 8.770e-5,  6.549  }, {   80, 1.905e-5,  5.799  }, {   90, 3.396e-6,  5.382  },
+        {  100, 5.297e-7,  5.877  }, {  110, 9.661e-8,  7.263  }, {  120, 2.438e-8,  9.473  },
+        {  130, 8.484e-9,  12.636 }, {  140, 3.845e-9,  16.149 }, {  150, 2.070e-9,  22.523 },
+        {  180, 5.464e-10, 29.740 }, {  200, 2.789e-10, 37.105 }, {  250, 7.248e-11, 45.546 },
+        {  300, 2.418e-11, 53.628 }, {  350, 9.518e-12, 53.298 }, {  400, 3.725e-12, 58.515 },
+        {  450, 1.585e-12, 60.828 }, {  500, 6.967e-13, 63.822 }, {  600, 1.454e-13, 71.835 },
+        {  700, 3.614e-14, 88.667 }, {  800, 1.170e-14, 124.64 }, {  900, 5.245e-15, 181.05 },
+        { 1000, 3.019e-15, 268.00 },
+    }};
+
+}
+
+double Environment::gmst(double julian_date)
+{
+    const double t = (julian_date - j2000) / 36525;
+
+    // in seconds of time, then converted to an angle with 240 seconds per degree
+    const double seconds = 67310.54841 + (876600.0 * 3600 + 8640184.812866) * t + 0.093104 * t * t - 6.2e-6 * t * t * t;
+    const double angle   = std::fmod(seconds / 240 * deg_2_rad, 2 * M_PI);
+
+    return (angle < 0) ? angle + 2 * M_PI : angle;
+}
+
+Eigen::Vector3d Environment::sun_position(double julian_date)
+{
+    const double t = (julian_date - j2000) / 36525;
+
+    const double mean_longitude = 280.460 + 36000.771 * t;
+    const double mean_anomaly   = (357.5291092 + 35999.05034 * t) * deg_2_rad;
+    const double longitude      = (mean_longitude + 1.914666471 * std::sin(mean_anomaly) +
+                                   0.019994643 * std::sin(2 * mean_anomaly)) * deg_2_rad;
+    const double distance       = 1.000140612 - 0.016708617 * std::cos(mean_anomaly) -
+                                  0.000139589 * std::cos(2 * mean_anomaly);
+    const double obliquity      = (23.439291 - 0.0130042 * t) * deg_2_rad;
+
+    return distance * astronomical_unit * Eigen::Vector3d(std::cos(longitude),
+                                                          std::cos(obliquity) * std::sin(longitude),
+                                                          std::sin(obliquity) * std::sin(longitude));
+}
+
+bool Environment::in_shadow(const Eigen::Vector3d &position, const Eigen::Vector3d &sun)
+{
+    const Eigen::Vector3d sun_direction = sun.normalized();
+    const double along = position.dot(sun_direction);
+
+    return (along < 0) && ((position - along * sun_direction).norm() < earth_radius);
+}
+
+double Environment::atmosphere_density(const Eigen::Vector3d &position)
+{
+    const double altitude = position.norm() - earth_radius;
+    if (altitude < 0)
+    {
+        return density_layers.front().base_density;
+    }
+
+    // the last layer whose base is below the altitude
+    auto layer = std::upper_bound(density_layers.begin(), density_layers.end(), altitude,
+                                  [](double a, const density_layer &l) { return a < l.base_altitude; });
+    --layer;
+
+    return layer->base_density * std::exp(-(altitude - layer->base_altitude) / layer->scale_height);
+}
+
+Eigen::Vector3d Environment::atmosphere_velocity(const Eigen::Vector3d &position, const Eigen::Vector3d &velocity)
+{
+    return velocity - Eigen::Vector3d(0, 0, earth_rotation).cross(position);
+}
@@ -25,7 +25,8 @@ namespace HelpMessages
             "    clean_out\n"
             "    unit_test\n"
             "    perf_test\n"
-            "    clean_plots\n\n" + 
+            "    clean_plots\n"
+            "    campaign <config_yaml> <exit_yaml> <campaign_yaml>\n\n" + 
             text_colour.reset +
 
             "For more info, type " + text_colour.yellow + "help <command>\n" +
@@ -131,7 +132,13 @@ namespace HelpMessages
             "    --print_rate <rate> " + text_colour.reset  + "sets the terminal print rate to the supplied rate in ms.\n"
             "      shorthand: "        + text_colour.yellow + "-p\n"
             "    --silence_plots     " + text_colour.reset  + "prevents the simulation from printing to the output csv.\n"
-            "      shorthand: "        + text_colour.yellow + "-sp\n" +
+            "      shorthand: "        + text_colour.yellow + "-sp\n"
+            "    --binary            " + text_colour.reset  + "writes the output as a binary telemetry file instead of a csv. Much\n"
+            "                        faster for long runs, see TelemetryFormat.hpp for the format.\n"
+            "      shorthand: "        + text_colour.yellow + "-b\n"
+            "    --precision <digits>" + text_colour.reset  + "sets the number of significant digits (1 to 9) in the csv and terminal\n"
+            "                        outputs. Defaults to 6.\n"
+            "      shorthand: "        + text_colour.yellow + "-pr\n" +
             text_colour.reset
         };
 
@@ -163,14 +170,22 @@ namespace HelpMessages
         {
             text_colour.yellow + 
             "unit_test " + text_colour.reset + "(shorthand: " + text_colour.yellow + "ut" + text_colour.reset + ")\n\n"
-            "Runs a predefined set of tests to ensure the simulation is working properly. The first 6 are\n"
-            "scenarios that have been calculated analytically. The results are compared against the exptected\n"
-            "results and a pass/fail is assigned. The last three tests use the controller, in the following three\n"
-            "scenarios:\n"
+            "Runs a predefined set of tests to ensure the simulation is working properly. The first 7 are\n"
+            "scenarios that have been calculated analytically, the last of them the gravity gradient torque on an\n"
+            "orbit. The results are compared against the exptected results and a pass/fail is assigned. The\n"
+            "last three tests use the controller, in the following three scenarios:\n"
             "    1. The satellite is given an initial state of rest, and is asked to stay in that state for 600\n"
             "       seconds\n"
             "    2. The satellite is given an initial velocity, and is asked to return to it's original state.\n"
             "    3. The satellite is at rest, and is requested to change attidue by around 30 degrees.\n\n"
+            "After the analytical tests, the orbit tests in unit_tests/orbit/ propagate the Orbit block of a\n"
+            "config yaml and compare it with published SGP4 results. The sun sensor tests then check the sun\n"
+            "sensor decoder against the sun sensor model with the sun in and out of the plane of the sensor,\n"
+            "and the attitude filter tests check the attitude and gyroscope bias the attitude filter estimates\n"
+            "from noisy measurements.\n\n"
+            "Between them, the regression tests in unit_tests/regression/ run the controller without any output\n"
+            "and pass or fail on whether it reaches the goal of its mode without any actuator command being\n"
+            "rejected. A pointing test with magnetorquers must also dump the wheel momentum across the field.\n\n"
             "The output directory and plotting directories are cleared before running the tests, so make sure to\n"
             "save any results you want before running this test.\n"
         };
@@ -180,8 +195,9 @@ namespace HelpMessages
             text_colour.yellow + 
             "perf_test " + text_colour.reset + "(shorthand: " + text_colour.yellow + "pt" + text_colour.reset + ")\n\n"
             "Runs a predefined set of tests in order to benchmark the efficiency of the simulator. Three tests\n"
-            "are run ten times each and their run time is then averaged and displayed to the user. This should be\n"
-            "used to determine how changes to the simulator effect efficiency.\n\n"
+            "are run ten times each and their run time and heap allocations and frees per simulated second are\n"
+            "then averaged and displayed to the user. This should be used to determine how changes to the\n"
+            "simulator effect efficiency.\n\n"
             "The output directory and plotting directories are cleared before running the tests, so make sure to\n"
             "save any results you want before running this test.\n"
         };
@@ -194,6 +210,16 @@ namespace HelpMessages
             "keep before running this command.\n"
         };
 
+        std::string campaign_help =
+        {
+            text_colour.yellow + 
+            "campaign <config_yaml> <exit_yaml> <campaign_yaml> " + text_colour.reset + "(shorthand: " + text_colour.yellow + "cm" + text_colour.reset + ")\n\n"
+            "Runs a Monte-Carlo campaign of the controller. Every run starts from the config and exit yamls, with\n"
+            "parameters randomly perturbed as described in the campaign yaml. Runs are simulated in parallel\n"
+            "without any terminal or csv output, and a summary of each run is saved to output/campaign_out.csv.\n"
+            "For an example campaign yaml, see unit_tests/campaign/.\n"
+        };
+
         std::unordered_map<std::string, std::string> command_to_help_map = 
         {
             {"start_sim",   start_sim_help},
@@ -203,6 +229,7 @@ namespace HelpMessages
             {"unit_test",   unit_test_help},
             {"perf_test",   perf_test_help},
             {"clean_plots", clean_plots_help},
+            {"campaign",    campaign_help},
 
             {"ss",  start_sim_help},
             {"rs",  resume_sim_help},
@@ -211,6 +238,7 @@ namespace HelpMessages
             {"ut",  unit_test_help},
             {"pt",  perf_test_help},
             {"cp",  clean_plots_help},
+            {"cm",  campaign_help},
         };
     }
 
@@ -0,0 +1,151 @@
+/**
+ * @file    Integrator.cpp
+ *
+ * @details implements the integrators as defined in Integrator.hpp
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include "Integrator.hpp"
+
+std::unique_ptr<Integrator> Integrator::create(IntegratorType type)
+{
+    switch (type)
+    {
+        case IntegratorType::Euler:
+            return std::make_unique<EulerIntegrator>();
+        case IntegratorType::RK4:
+            return std::make_unique<RK4Integrator>();
+        case IntegratorType::RK45:
+            return std::make_unique<RK45Integrator>();
+    }
+
+    throw invalid_integrator("Unknown integrator type.");
+}
+
+void Integrator::resize(Eigen::Index size)
+{
+    this->k1.resize(size);
+    this->error.setZero(size);
+}
+
+void EulerIntegrator::resize(Eigen::Index size)
+{
+    Integrator::resize(size);
+    this->k2.resize(size);
+    this->stage.resize(size);
+}
+
+const Eigen::VectorXf &EulerIntegrator::step(const derivative_function &derivative, Eigen::VectorXf &state, float dt)
+{
+    if (this->k1.size() != state.size())
+    {
+        this->resize(state.size());
+    }
+
+    derivative(state, this->k1);
+    if (0 == this->kinematic_size)
+    {
+        state += dt * this->k1;
+        return this->error;
+    }
+
+    // advance the rates first, then the kinematic elements with the new rates
+    this->stage = state + dt * this->k1;
+    this->stage.segment(this->kinematic_start, this->kinematic_size) = state.segment(this->kinematic_start, this->kinematic_size);
+    derivative(this->stage, this->k2);
+
+    state = this->stage;
+    state.segment(this->kinematic_start, this->kinematic_size) += dt * this->k2.segment(this->kinematic_start, this->kinematic_size);
+
+    return this->error;
+}
+
+void RK4Integrator::resize(Eigen::Index size)
+{
+    Integrator::resize(size);
+    this->k2.resize(size);
+    this->k3.resize(size);
+    this->k4.resize(size);
+    this->stage.resize(size);
+}
+
+const Eigen::VectorXf &RK4Integrator::step(const derivative_function &derivative, Eigen::VectorXf &state, float dt)
+{
+    if (this->k1.size() != state.size())
+    {
+        this->resize(state.size());
+    }
+
+    derivative(state, this->k1);
+
+    this->stage = state + (dt / 2) * this->k1;
+    derivative(this->stage, this->k2);
+
+    this->stage = state + (dt / 2) * this->k2;
+    derivative(this->stage, this->k3);
+
+    this->stage = state + dt * this->k3;
+    derivative(this->stage, this->k4);
+
+    state += (dt / 6) * (this->k1 + 2 * this->k2 + 2 * this->k3 + this->k4);
+
+    return this->error;
+}
+
+void RK45Integrator::resize(Eigen::Index size)
+{
+    Integrator::resize(size);
+    this->k2.resize(size);
+    this->k3.resize(size);
+    this->k4.resize(size);
+    this->k5.resize(size);
+    this->k6.resize(size);
+    this->k7.resize(size);
+    this->stage.resize(size);
+}
+
+const Eigen::VectorXf &RK45Integrator::step(const derivative_function &derivative, Eigen::VectorXf &state, float dt)
+{
+    /* Dormand-Prince tableau. The fifth order weights are the last row of the tableau. */
+    constexpr float a21 = 1.0f/5;
+    constexpr float a31 = 3.0f/40,       a32 = 9.0f/40;
+    constexpr float a41 = 44.0f/45,      a42 = -56.0f/15,      a43 = 32.0f/9;
+    constexpr float a51 = 19372.0f/6561, a52 = -25360.0f/2187, a53 = 64448.0f/6561, a54 = -212.0f/729;
+    constexpr float a61 = 9017.0f/3168,  a62 = -355.0f/33,     a63 = 46732.0f/5247, a64 = 49.0f/176,  a65 = -5103.0f/18656;
+    constexpr float b1  = 35.0f/384,     b3  = 500.0f/1113,    b4  = 125.0f/192,    b5  = -2187.0f/6784, b6 = 11.0f/84;
+
+    /* difference between the fifth and fourth order weights */
+    constexpr float e1 = 71.0f/57600, e3 = -71.0f/16695, e4 = 71.0f/1920, e5 = -17253.0f/339200, e6 = 22.0f/525, e7 = -1.0f/40;
+
+    if (this->k1.size() != state.size())
+    {
+        this->resize(state.size());
+    }
+
+    derivative(state, this->k1);
+
+    this->stage = state + dt * (a21 * this->k1);
+    derivative(this->stage, this->k2);
+
+    this->stage = state + dt * (a31 * this->k1 + a32 * this->k2);
+    derivative(this->stage, this->k3);
+
+    this->stage = state + dt * (a41 * this->k1 + a42 * this->k2 + a43 * this->k3);
+    derivative(this->stage, this->k4);
+
+    this->stage = state + dt * (a51 * this->k1 + a52 * this->k2 + a53 * this->k3 + a54 * this->k4);
+    derivative(this->stage, this->k5);
+
+    this->stage = state + dt * (a61 * this->k1 + a62 * this->k2 + a63 * this->k3 + a64 * this->k4 + a65 * this->k5);
+    derivative(this->stage, this->k6);
+
+    state += dt * (b1 * this->k1 + b3 * this->k3 + b4 * this->k4 + b5 * this->k5 + b6 * this->k6);
+    derivative(state, this->k7);
+
+    this->error = dt * (e1 * this->k1 + e3 * this->k3 + e4 * this->k4 + e5 * this->k5 + e6 * this->k6 + e7 * this->k7);
+
+    return this->error;
+}
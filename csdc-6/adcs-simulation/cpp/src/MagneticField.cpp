@@ -0,0 +1,224 @@
+/**
+ * @file    MagneticField.cpp
+ *
+ * @details implements the model of the earth's magnetic field as defined in MagneticField.hpp. The
+ *          recursion follows Wertz, Spacecraft Attitude Determination and Control, appendix H.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <algorithm>
+#include <cmath>
+
+#include "MagneticField.hpp"
+#include "Environment.hpp"
+
+namespace
+{
+    /* Julian date of the epoch of the coefficients, 2020.0 */
+    constexpr double igrf_epoch = 2458849.5;
+
+    /* the secular variation is applied again once the date has moved by this many days */
+    constexpr double coefficient_update_period = 1.0;
+
+    constexpr size_t index(uint32_t n, uint32_t m) { return n * (n + 1) / 2 + m; }
+
+    /* IGRF-13 main field at 2020.0, in nT, indexed by n * (n + 1) / 2 + m */
+    constexpr std::array<double, MagneticField::table_size> igrf_g = {
+             0.0,
+        -29404.8, -1450.9,
+         -2499.6,  2982.0,  1677.0,
+          1363.2, -2381.2,  1236.2,   525.7,
+           903.0,   809.5,    86.3,  -309.4,    48.0,
+          -234.3,   363.2,   187.8,  -140.7,  -151.2,    13.5,
+            66.0,    65.5,    72.9,  -121.5,   -36.2,    13.5,   -64.7,
+            80.6,   -76.7,    -8.2,    56.5,    15.8,     6.4,    -7.2,     9.8,
+            23.7,     9.7,   -17.6,    -0.5,   -21.1,    15.3,    13.7,   -16.5,    -0.3,
+    };
+
+    constexpr std::array<double, MagneticField::table_size> igrf_h = {
+             0.0,
+             0.0,  4652.5,
+             0.0, -2991.6,  -734.6,
+             0.0,   -82.1,   241.9,  -543.4,
+             0.0,   281.9,  -158.4,   199.7,  -349.7,
+             0.0,    47.7,   208.3,  -121.2,    32.3,    98.9,
+             0.0,   -19.1,    25.1,    52.8,   -64.5,     8.9,    68.1,
+             0.0,   -51.5,   -16.9,     2.2,    23.5,    -2.2,   -27.2,    -1.8,
+             0.0,     8.4,   -15.3,    12.8,   -11.7,    14.9,     3.6,    -6.9,     2.8,
+    };
+
+    /* IGRF-13 secular variation for 2020-2025, in nT/year */
+    constexpr std::array<double, MagneticField::table_size> igrf_g_rate = {
+             0.0,
+             5.7,     7.4,
+           -11.0,    -7.0,    -2.1,
+             2.2,    -5.9,     3.1,   -12.0,
+            -1.2,    -1.6,    -5.9,     5.2,    -5.1,
+            -0.3,     0.5,    -0.6,     0.2,     1.3,     0.9,
+            -0.5,    -0.3,     0.4,     1.3,    -1.4,     0.0,     0.9,
+            -0.1,    -0.2,     0.0,     0.7,     0.1,    -0.5,    -0.8,     0.8,
+             0.0,     0.1,    -0.1,     0.4,    -0.1,     0.4,     0.3,    -0.1,     0.4,
+    };
+
+    constexpr std::array<double, MagneticField::table_size> igrf_h_rate = {
+             0.0,
+             0.0,   -25.9,
+             0.0,   -30.2,   -22.4,
+             0.0,     6.0,    -1.1,     0.5,
+             0.0,    -0.1,     6.5,     3.6,    -5.0,
+             0.0,     0.0,     2.5,    -0.6,     3.0,     0.3,
+             0.0,     0.0,    -1.6,    -1.3,     0.8,     0.0,     1.0,
+             0.0,     0.6,     0.6,    -0.8,    -0.2,    -1.1,     0.1,     0.3,
+             0.0,    -0.2,     0.6,    -0.2,     0.5,    -0.3,    -0.4,     0.5,     0.0,
+    };
+}
+
+MagneticField::MagneticField(uint32_t degree)
+{
+    this->degree = std::clamp(degree, 1u, max_degree);
+
+    this->schmidt.fill(0);
+    this->recursion.fill(0);
+    this->schmidt[0] = 1;
+
+    for (uint32_t n = 1; n <= max_degree; n++)
+    {
+        this->schmidt[index(n, 0)] = this->schmidt[index(n - 1, 0)] * (2 * n - 1) / n;
+        for (uint32_t m = 1; m <= n; m++)
+        {
+            const double kronecker = (1 == m) ? 2 : 1;
+            this->schmidt[index(n, m)] = this->schmidt[index(n, m - 1)] * std::sqrt((n - m + 1) * kronecker / (n + m));
+        }
+
+        for (uint32_t m = 0; (n > 1) && (m <= n - 2); m++)
+        {
+            this->recursion[index(n, m)] = static_cast<double>((n - 1) * (n - 1) - m * m) / ((2 * n - 1) * (2 * n - 3));
+        }
+    }
+
+    this->legendre.fill(0);
+    this->legendre_derivative.fill(0);
+    this->legendre[0] = 1;
+
+    this->update_coefficients(igrf_epoch);
+}
+
+Eigen::Vector3d MagneticField::field(const Eigen::Vector3d &position, double julian_date)
+{
+    if ((position == this->last_position) && (julian_date == this->last_date))
+    {
+        return this->last_field;
+    }
+
+    if (std::abs(julian_date - this->coefficient_date) > coefficient_update_period)
+    {
+        this->update_coefficients(julian_date);
+    }
+
+    // the field is fixed to the earth, so it is found in the earth fixed frame
+    const double sidereal     = Environment::gmst(julian_date);
+    const double cos_sidereal = std::cos(sidereal);
+    const double sin_sidereal = std::sin(sidereal);
+    const Eigen::Vector3d position_ecef( cos_sidereal * position.x() + sin_sidereal * position.y(),
+                                        -sin_sidereal * position.x() + cos_sidereal * position.y(),
+                                         position.z());
+
+    const double radius     = position_ecef.norm();
+    const double horizontal = position_ecef.head<2>().norm();
+    const double cos_theta  = position_ecef.z() / radius;
+    const double sin_theta  = std::max(horizontal / radius, 1.0e-12);
+    const double cos_phi    = (horizontal > 0) ? position_ecef.x() / horizontal : 1.0;
+    const double sin_phi    = (horizontal > 0) ? position_ecef.y() / horizontal : 0.0;
+
+    std::array<double, max_degree + 1> cos_m_phi;
+    std::array<double, max_degree + 1> sin_m_phi;
+    cos_m_phi[0] = 1;
+    sin_m_phi[0] = 0;
+    for (uint32_t m = 1; m <= this->degree; m++)
+    {
+        cos_m_phi[m] = cos_m_phi[m - 1] * cos_phi - sin_m_phi[m - 1] * sin_phi;
+        sin_m_phi[m] = sin_m_phi[m - 1] * cos_phi + cos_m_phi[m - 1] * sin_phi;
+    }
+
+    double b_r     = 0;
+    double b_theta = 0;
+    double b_phi   = 0;
+
+    const double ratio = reference_radius / radius;
+    double scale = ratio * ratio;
+
+    for (uint32_t n = 1; n <= this->degree; n++)
+    {
+        scale *= ratio;
+
+        double sum_r     = 0;
+        double sum_theta = 0;
+        double sum_phi   = 0;
+
+        for (uint32_t m = 0; m <= n; m++)
+        {
+            const size_t i = index(n, m);
+            double &p  = this->legendre[i];
+            double &dp = this->legendre_derivative[i];
+
+            if (n == m)
+            {
+                const size_t previous = index(n - 1, m - 1);
+                p  = sin_theta * this->legendre[previous];
+                dp = sin_theta * this->legendre_derivative[previous] + cos_theta * this->legendre[previous];
+            }
+            else
+            {
+                const size_t previous = index(n - 1, m);
+                p  = cos_theta * this->legendre[previous];
+                dp = cos_theta * this->legendre_derivative[previous] - sin_theta * this->legendre[previous];
+                if (m + 2 <= n)
+                {
+                    p  -= this->recursion[i] * this->legendre[index(n - 2, m)];
+                    dp -= this->recursion[i] * this->legendre_derivative[index(n - 2, m)];
+                }
+            }
+
+            const double longitude_term = this->g[i] * cos_m_phi[m] + this->h[i] * sin_m_phi[m];
+            sum_r     += longitude_term * p;
+            sum_theta += longitude_term * dp;
+            sum_phi   += m * (this->h[i] * cos_m_phi[m] - this->g[i] * sin_m_phi[m]) * p;
+        }
+
+        b_r     += scale * (n + 1) * sum_r;
+        b_theta -= scale * sum_theta;
+        b_phi   -= scale * sum_phi;
+    }
+    b_phi /= sin_theta;
+
+    // from the local spherical frame to the earth fixed frame, then to the inertial frame
+    const double b_horizontal = b_r * sin_theta + b_theta * cos_theta;
+    const Eigen::Vector3d field_ecef(b_horizontal * cos_phi - b_phi * sin_phi,
+                                     b_horizontal * sin_phi + b_phi * cos_phi,
+                                     b_r * cos_theta - b_theta * sin_theta);
+
+    this->last_position = position;
+    this->last_date     = julian_date;
+    this->last_field    = 1.0e-9 * Eigen::Vector3d(cos_sidereal * field_ecef.x() - sin_sidereal * field_ecef.y(),
+                                                   sin_sidereal * field_ecef.x() + cos_sidereal * field_ecef.y(),
+                                                   field_ecef.z());
+
+    return this->last_field;
+}
+
+void MagneticField::update_coefficients(double julian_date)
+{
+    const double years = (julian_date - igrf_epoch) / 365.25;
+
+    for (size_t i = 0; i < table_size; i++)
+    {
+        this->g[i] = this->schmidt[i] * (igrf_g[i] + years * igrf_g_rate[i]);
+        this->h[i] = this->schmidt[i] * (igrf_h[i] + years * igrf_h_rate[i]);
+    }
+    this->coefficient_date = julian_date;
+
+    return;
+}
@@ -14,9 +14,12 @@
 #include <iostream>
 #include <fstream>
 #include <filesystem>
+#include <stdexcept>
 #include <tgmath.h>
+#include <cstring>
 
 #include "Messenger.hpp"
+#include "TelemetryFormat.hpp"
 
 void Messenger::send_message(std::string msg, std::string colour)
 {
@@ -26,6 +29,11 @@ void Messenger::send_message(std::string msg, std::string colour)
         throw invalid_message("Message to send to UI is empty.");
     }
 
+    if (silent_messages)
+    {
+        return;
+    }
+
     // This can be formatted nicely later.
     std::cout << colour << msg << text_colour.reset << std::endl;
     return;
@@ -39,6 +47,11 @@ void Messenger::send_warning(std::string msg)
         throw invalid_message("Warning to send to UI is empty.");
     }
 
+    if (silent_messages)
+    {
+        return;
+    }
+
     // This can be formatted nicely later.
     std::cout << text_colour.yellow << "WARNING: " << msg << text_colour.reset << std::endl;
     return;
@@ -60,13 +73,21 @@ void Messenger::send_error(std::string msg)
 
 void Messenger::start_new_sim(uint32_t num_reaction_wheels)
 {
+    /* print rates are relative to the start of each run */
+    previous_csv_write      = 0;
+    previous_terminal_write = 0;
+
+    /* a previous run that did not reach its timeout may have left its file open */
+    this->close_output_file();
+    this->set_output_columns(num_reaction_wheels);
+
     if (!silent_sim_prints)
     {
         write_cout_header(num_reaction_wheels);
     }
     if (!silent_csv_prints)
     {
-        write_csv_header(num_reaction_wheels);
+        this->open_output_file();
     }
 
     return;
@@ -93,26 +114,42 @@ void Messenger::write_cout_header(uint32_t num_reaction_wheels)
     return;
 }
 
-void Messenger::write_csv_header(uint32_t num_reaction_wheels)
+void Messenger::write_csv_header()
+{
+    for (const std::string &column : this->output_columns)
+    {
+        this->output_stream << column << ",";
+    }
+    this->output_stream << '\n';
+
+    return;
+}
+
+void Messenger::set_output_columns(uint32_t num_reaction_wheels)
 {
-    /* Empty the output buffer */
-    this->output_file_buffer.clear();
-    this->output_file_buffer.str(std::string());
+    this->num_reaction_wheels = num_reaction_wheels;
+    this->output_columns =
+    {
+        "Time", "Timestep", "Satellite theta x", "Satellite theta y", "Satellite theta z",
+        "Satellite q w", "Satellite q x", "Satellite q y", "Satellite q z",
+        "Satellite Omega x", "Satellite Omega y", "Satellite Omega z",
+        "Satellite alpha x", "Satellite alpha y", "Satellite alpha z",
+        "Accelerometer x", "Accelerometer y", "Accelerometer z"
+    };
 
-    /* Write the new header */
-    this->output_file_buffer << "Time,Timestep,Satellite theta x,Satellite theta y,Satellite theta z,Satellite Omega x,Satellite Omega y,Satellite Omega z,";
-    this->output_file_buffer << "Satellite alpha x,Satellite alpha y,Satellite alpha z,Accelerometer x,Accelerometer y,Accelerometer z,";//Gyro x,Gyro y,Gyro z,";
     for (uint32_t i = 0; i < num_reaction_wheels; i++)
     {
-        this->output_file_buffer << "Reaction wheel " << i << " Omega,Reaction wheel " << i << " alpha,";
+        this->output_columns.push_back("Reaction wheel " + std::to_string(i) + " Omega");
+        this->output_columns.push_back("Reaction wheel " + std::to_string(i) + " alpha");
     }
-    this->output_file_buffer << std::endl;
+
+    this->output_record.resize(this->output_columns.size());
 
     return;
 }
 
 
-void Messenger::update_simulation_state(sim_config state, timestamp time, timestamp timestep)
+void Messenger::update_simulation_state(const sim_config &state, timestamp time, timestamp timestep)
 {
     if ( (!silent_sim_prints) &&
          (terminal_print_rate <= (time - previous_terminal_write)) )
@@ -121,7 +158,7 @@ void Messenger::update_simulation_state(sim_config state, timestamp time, timest
         previous_terminal_write = time;
     }
 
-    if ( (!silent_csv_prints) &&
+    if ( (nullptr != output_writer) &&
          (csv_print_rate <= (time - previous_csv_write)) )
     {
         this->append_csv_output(state, time, timestep);
@@ -131,52 +168,203 @@ void Messenger::update_simulation_state(sim_config state, timestamp time, timest
     return;
 }
 
-void Messenger::append_cout_output(sim_config state, timestamp time, timestamp timestep)
+void Messenger::append_cout_output(const sim_config &state, timestamp time, timestamp timestep)
 {
-    std::cout << text_colour.reset << time.pretty_string() << "\t" << timestep.pretty_string() << "\t";
-    std::cout << state.satellite.theta_b.x() << ", " << state.satellite.theta_b.y() << ", " << state.satellite.theta_b.z() << ";\t\t";
-    std::cout << state.satellite.omega_b.x() << ", " << state.satellite.omega_b.y() << ", " << state.satellite.omega_b.z() << ";\t\t";
-    std::cout << state.satellite.alpha_b.x() << ", " << state.satellite.alpha_b.y() << ", " << state.satellite.alpha_b.z() << ";\t";
-
-    std::cout << state.accelerometer.measurement.x() << ", " << state.accelerometer.measurement.y() << ", " << state.accelerometer.measurement.z() << ";\t";
-    // std::cout << state.gyroscope.measurement.x()     << ", " << state.gyroscope.measurement.y()     << ", " << state.gyroscope.measurement.z() << ";";
+    RowFormatter &row = this->cout_formatter;
+    row.clear();
+
+    row.append(text_colour.reset);
+    row.append_timestamp(time);
+    row.append('\t');
+    row.append_timestamp(timestep);
+    row.append('\t');
+    this->append_vector(state.satellite.theta_b);
+    row.append(";\t\t");
+    this->append_vector(state.satellite.omega_b);
+    row.append(";\t\t");
+    this->append_vector(state.satellite.alpha_b);
+    row.append(";\t");
+
+    this->append_vector(state.accelerometer.measurement);
+    row.append(";\t");
 
     for (uint32_t i = 0; i < state.reaction_wheels.size(); i++)
     {
-        std::cout << "\t" << state.reaction_wheels.at(i).omega << ", " << state.reaction_wheels.at(i).alpha << ";";
+        row.append('\t');
+        row.append(state.reaction_wheels.omega(i));
+        row.append(", ");
+        row.append(state.reaction_wheels.alpha(i));
+        row.append(';');
 
         if (i < state.reaction_wheels.size() - 1)
         {
-            std::cout << "\t";
+            row.append('\t');
         }
     }
-    std::cout << std::endl;
+    row.append('\n');
+
+    std::cout.write(row.view().data(), row.view().size());
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (terminal_flush_period <= now - previous_terminal_flush)
+    {
+        std::cout.flush();
+        previous_terminal_flush = now;
+    }
 
     return;
 }
 
-void Messenger::append_csv_output(sim_config state, timestamp time, timestamp timestep)
+void Messenger::append_vector(const Eigen::Vector3f &vector)
 {
-    this->output_file_buffer << (float)time << "," << (float)timestep <<",";
-    this->output_file_buffer << state.satellite.theta_b.x() << "," << state.satellite.theta_b.y() << "," << state.satellite.theta_b.z() << ",";
-    this->output_file_buffer << state.satellite.omega_b.x() << "," << state.satellite.omega_b.y() << "," << state.satellite.omega_b.z() << ",";
-    this->output_file_buffer << state.satellite.alpha_b.x() << "," << state.satellite.alpha_b.y() << "," << state.satellite.alpha_b.z() << ",";
+    this->cout_formatter.append(vector.x());
+    this->cout_formatter.append(", ");
+    this->cout_formatter.append(vector.y());
+    this->cout_formatter.append(", ");
+    this->cout_formatter.append(vector.z());
 
-    this->output_file_buffer << state.accelerometer.measurement.x() << "," << state.accelerometer.measurement.y() << "," << state.accelerometer.measurement.z() << ",";
-    // output_file << state.gyroscope.measurement.x()     << "," << state.gyroscope.measurement.y()     << "," << state.gyroscope.measurement.z()     << ",";
+    return;
+}
 
-    for (uint32_t i = 0; i < state.reaction_wheels.size(); i++)
+void Messenger::fill_output_record(const sim_config &state, timestamp time, timestamp timestep)
+{
+    float *record = this->output_record.data();
+
+    *record++ = (float)time;
+    *record++ = (float)timestep;
+    for (int i = 0; i < 3; i++)
     {
-        this->output_file_buffer << state.reaction_wheels.at(i).omega << "," << state.reaction_wheels.at(i).alpha << ",";
+        *record++ = state.satellite.theta_b(i);
+    }
+    *record++ = state.satellite.attitude_b.w();
+    *record++ = state.satellite.attitude_b.x();
+    *record++ = state.satellite.attitude_b.y();
+    *record++ = state.satellite.attitude_b.z();
+    for (int i = 0; i < 3; i++)
+    {
+        *record++ = state.satellite.omega_b(i);
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        *record++ = state.satellite.alpha_b(i);
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        *record++ = state.accelerometer.measurement(i);
+    }
+
+    /* the wheel count is fixed by the header, so a mismatched state can not overrun the record */
+    if (state.reaction_wheels.size() < this->num_reaction_wheels)
+    {
+        throw std::out_of_range("Simulation state has fewer reaction wheels than the output header.");
+    }
+
+    for (uint32_t i = 0; i < this->num_reaction_wheels; i++)
+    {
+        *record++ = state.reaction_wheels.omega(i);
+        *record++ = state.reaction_wheels.alpha(i);
     }
-    this->output_file_buffer << std::endl;
 
     return;
 }
 
-void Messenger::write_output_buffer()
+void Messenger::append_csv_output(const sim_config &state, timestamp time, timestamp timestep)
+{
+    this->fill_output_record(state, time, timestep);
+
+    /* rows end in a plain newline, as flushing would wait for the file to be written */
+    if (OutputFormat::Binary == this->output_format)
+    {
+        this->output_stream.write(reinterpret_cast<const char *>(this->output_record.data()), this->output_record.size() * sizeof(float));
+    }
+    else
+    {
+        this->csv_formatter.clear();
+        for (float value : this->output_record)
+        {
+            this->csv_formatter.append(value);
+            this->csv_formatter.append(',');
+        }
+        this->csv_formatter.append('\n');
+        this->output_stream.write(this->csv_formatter.view().data(), this->csv_formatter.view().size());
+    }
+
+    return;
+}
+
+void Messenger::open_output_file()
 {
     /* Determine output file name */
+    try
+    {
+        std::string extension = (OutputFormat::Binary == this->output_format) ? Telemetry::extension : this->csv_ext;
+        this->output_file_path_string = this->get_new_output_file(this->default_csv_name, extension);
+    }
+    catch (invalid_messagenger_param &e)
+    {
+        this->output_file_path_string = "-1";
+        throw;
+    }
+
+    this->output_writer = std::make_unique<OutputWriter>(this->output_file_path_string, this->background_output);
+    this->output_stream.rdbuf(this->output_writer.get());
+
+    if (OutputFormat::Binary == this->output_format)
+    {
+        this->write_binary_header();
+    }
+    else
+    {
+        this->write_csv_header();
+    }
+
+    return;
+}
+
+void Messenger::close_output_file()
+{
+    if (nullptr == this->output_writer)
+    {
+        return;
+    }
+
+    /* the writer is released even if the last writes fail */
+    std::unique_ptr<OutputWriter> writer = std::move(this->output_writer);
+    this->output_stream.rdbuf(nullptr);
+    writer->close();
+
+    return;
+}
+
+void Messenger::write_binary_header()
+{
+    Telemetry::telemetry_header header = {};
+    std::memcpy(header.magic, Telemetry::magic, sizeof(Telemetry::magic));
+    header.version             = Telemetry::version;
+    header.byte_order_mark     = Telemetry::byte_order_mark;
+    header.num_columns         = this->output_columns.size();
+    header.num_reaction_wheels = this->num_reaction_wheels;
+
+    /* the column names follow the fixed header, and the records start at the next aligned offset */
+    std::string names;
+    for (const std::string &column : this->output_columns)
+    {
+        names += column;
+        names += '\0';
+    }
+
+    uint32_t unpadded_size = sizeof(header) + names.size();
+    header.header_size     = ((unpadded_size + Telemetry::header_alignment - 1) / Telemetry::header_alignment) * Telemetry::header_alignment;
+    names.resize(header.header_size - sizeof(header), '\0');
+
+    this->output_stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    this->output_stream.write(names.data(), names.size());
+
+    return;
+}
+
+std::string Messenger::get_new_output_file(const std::string &name, const std::string &extension)
+{
     // std::string cwd = std::filesystem::current_path();
     std::string csv_path = "./" + this->default_csv_path;
     std::string suffix = "";
@@ -187,44 +375,20 @@ void Messenger::write_output_buffer()
         std::filesystem::create_directory(csv_path);
     }
 
-    csv_path += this->default_csv_name;
+    csv_path += name;
 
     /* search for file if it exists, increment if it does */
-    while(std::filesystem::exists(csv_path + suffix + this->csv_ext))
+    while(std::filesystem::exists(csv_path + suffix + extension))
     {
         if (UINT32_MAX <= suffix_num)
         {
-            this->output_file_path_string = "-1";
             throw invalid_messagenger_param("Unable to create output CSV, too many files exist.");
         }
         suffix_num++;
         suffix = std::to_string(suffix_num);
     }
 
-    /* Open the file and write out the buffer */
-    if ("-1" != this->output_file_path_string)
-    {
-        this->output_file_path_string = csv_path + suffix + this->csv_ext;
-
-        std::ofstream output_file(output_file_path_string, std::fstream::out | std::fstream::app);
-        if (output_file.is_open())
-        {
-            if ("" == output_file_buffer.str())
-            {
-                send_error("output buffer is empty");
-            }
-            std::string line;
-            while (getline(this->output_file_buffer, line))
-            {
-                output_file << line << std::endl;
-            }
-            output_file.close();
-        }
-        else
-        {
-            throw invalid_messagenger_param(std::string("Unable to open file " + output_file_path_string).c_str());
-        }
-    }
+    return csv_path + suffix + extension;
 }
 
 void Messenger::clean_csv_files()
@@ -249,10 +413,15 @@ void Messenger::silence_sim_prints()
 
 void Messenger::reset_defaults()
 {
+    this->close_output_file();
     this->silent_sim_prints   = default_silent_sim_prints;
     this->csv_print_rate      = default_csv_print_rate;
     this->terminal_print_rate = default_terminal_print_rate;
     this->silent_csv_prints   = default_silent_csv_prints;
+    this->silent_messages     = false;
+    this->output_format       = default_output_format;
+    this->csv_formatter.set_precision(RowFormatter::default_precision);
+    this->cout_formatter.set_precision(RowFormatter::default_precision);
     return;
 }
 
@@ -270,8 +439,31 @@ void Messenger::set_terminal_print_rate(uint32_t terminal_rate)
     return;
 }
 
+void Messenger::set_output_format(OutputFormat format)
+{
+    this->output_format = format;
+    this->send_message(std::string("Output format: ") + ((OutputFormat::Binary == format) ? "binary." : "csv."));
+    return;
+}
+
+void Messenger::set_output_precision(int precision)
+{
+    this->csv_formatter.set_precision(precision);
+    this->cout_formatter.set_precision(precision);
+    this->send_message("Output precision: " + std::to_string(precision) + " digits.");
+    return;
+}
+
 void Messenger::silence_csv()
 {
     this->silent_csv_prints = true;
     return;
 }
+
+void Messenger::silence_all()
+{
+    this->silent_messages   = true;
+    this->silent_sim_prints = true;
+    this->silent_csv_prints = true;
+    return;
+}
@@ -0,0 +1,176 @@
+/**
+ * @file    OutputWriter.cpp
+ *
+ * @details implements the OutputWriter class as defined in OutputWriter.hpp
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include "OutputWriter.hpp"
+
+OutputWriter::OutputWriter(const std::string &path, bool background, size_t chunk_size) :
+    file(path, std::fstream::out | std::fstream::trunc | std::fstream::binary),
+    active(chunk_size)
+{
+    if (!this->file.is_open())
+    {
+        throw output_write_failure("Unable to open the output file.");
+    }
+
+    this->open = true;
+    this->setp(this->active.data(), this->active.data() + this->active.size());
+
+    if (background)
+    {
+        this->pending.resize(chunk_size);
+        this->writer = std::thread(&OutputWriter::write_chunks, this);
+    }
+}
+
+OutputWriter::~OutputWriter()
+{
+    try
+    {
+        this->close();
+    }
+    catch (output_write_failure &e)
+    {
+        // nothing can be done about it here
+    }
+}
+
+void OutputWriter::close()
+{
+    if (!this->open)
+    {
+        return;
+    }
+
+    this->hand_off();
+
+    if (this->writer.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+            this->stopping = true;
+        }
+        this->pending_changed.notify_all();
+        this->writer.join();
+    }
+
+    this->file.close();
+    this->open = false;
+
+    if (this->failed || this->file.fail())
+    {
+        throw output_write_failure("Unable to write the output file.");
+    }
+
+    return;
+}
+
+OutputWriter::int_type OutputWriter::overflow(int_type c)
+{
+    if (!this->open)
+    {
+        return traits_type::eof();
+    }
+
+    this->hand_off();
+
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+    {
+        *this->pptr() = traits_type::to_char_type(c);
+        this->pbump(1);
+    }
+
+    return traits_type::not_eof(c);
+}
+
+int OutputWriter::sync()
+{
+    if (this->open)
+    {
+        this->hand_off();
+        this->wait_for_writes();
+    }
+
+    return this->failed ? -1 : 0;
+}
+
+void OutputWriter::hand_off()
+{
+    size_t size = this->pptr() - this->pbase();
+    if (0 == size)
+    {
+        return;
+    }
+
+    if (!this->writer.joinable())
+    {
+        if (!this->file.write(this->active.data(), size))
+        {
+            this->failed = true;
+        }
+    }
+    else
+    {
+        /* the previous chunk must be written before its buffer can be reused */
+        std::unique_lock<std::mutex> guard(this->lock);
+        this->pending_changed.wait(guard, [this]{ return 0 == this->pending_size; });
+
+        this->active.swap(this->pending);
+        this->pending_size = size;
+
+        guard.unlock();
+        this->pending_changed.notify_all();
+    }
+
+    this->setp(this->active.data(), this->active.data() + this->active.size());
+
+    return;
+}
+
+void OutputWriter::wait_for_writes()
+{
+    if (this->writer.joinable())
+    {
+        std::unique_lock<std::mutex> guard(this->lock);
+        this->pending_changed.wait(guard, [this]{ return 0 == this->pending_size; });
+    }
+
+    return;
+}
+
+void OutputWriter::write_chunks()
+{
+    std::unique_lock<std::mutex> guard(this->lock);
+
+    while (true)
+    {
+        this->pending_changed.wait(guard, [this]{ return (0 != this->pending_size) || this->stopping; });
+
+        if (0 == this->pending_size)
+        {
+            /* stopping, and everything has been written */
+            break;
+        }
+
+        /* the pending chunk is not touched by the simulation until pending_size is cleared */
+        size_t size = this->pending_size;
+        guard.unlock();
+        bool written = static_cast<bool>(this->file.write(this->pending.data(), size));
+        guard.lock();
+
+        if (!written)
+        {
+            this->failed = true;
+        }
+        this->pending_size = 0;
+        this->pending_changed.notify_all();
+    }
+
+    return;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file    RowFormatter.cpp
+ *
+ * @details implements the RowFormatter class as defined in RowFormatter.hpp
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <charconv>
+#include <cstring>
+
+#include "RowFormatter.hpp"
+
+RowFormatter::RowFormatter(int precision) : buffer(256)
+{
+    this->set_precision(precision);
+}
+
+void RowFormatter::set_precision(int precision)
+{
+    if ( (1 > precision) || (max_precision < precision) )
+    {
+        throw invalid_row_format("Precision must be between 1 and 9 digits.");
+    }
+
+    this->precision = precision;
+    return;
+}
+
+void RowFormatter::append(float value)
+{
+    this->make_room(max_float_chars);
+
+    char *start = this->buffer.data() + this->length;
+    std::to_chars_result result = std::to_chars(start, this->buffer.data() + this->buffer.size(), value,
+                                                std::chars_format::general, this->precision);
+    this->length = result.ptr - this->buffer.data();
+
+    return;
+}
+
+void RowFormatter::append(std::string_view text)
+{
+    this->make_room(text.size());
+    std::memcpy(this->buffer.data() + this->length, text.data(), text.size());
+    this->length += text.size();
+
+    return;
+}
+
+void RowFormatter::append(char character)
+{
+    this->make_room(1);
+    this->buffer[this->length++] = character;
+
+    return;
+}
+
+void RowFormatter::append_timestamp(timestamp time)
+{
+    this->make_room(max_timestamp_chars);
+
+    int64_t total_ms = time.microseconds() / timestamp::microseconds_per_millisecond;
+    bool negative = total_ms < 0;
+    if (negative)
+    {
+        total_ms = -total_ms;
+    }
+
+    int64_t out_mil = total_ms % 1000;
+    int64_t out_sec = total_ms / 1000;
+    int64_t out_min = out_sec / 60;
+    out_sec %= 60;
+
+    char *position = this->buffer.data() + this->length;
+    char *end      = this->buffer.data() + this->buffer.size();
+
+    *position++ = '[';
+    if (negative)
+    {
+        *position++ = '-';
+    }
+    position = std::to_chars(position, end, out_min).ptr;
+    *position++ = ':';
+    *position++ = '0' + out_sec / 10;
+    *position++ = '0' + out_sec % 10;
+    *position++ = ':';
+
+    /* milliseconds are padded to four digits, as in pretty_string */
+    *position++ = '0';
+    *position++ = '0' + out_mil / 100;
+    *position++ = '0' + (out_mil / 10) % 10;
+    *position++ = '0' + out_mil % 10;
+    *position++ = ']';
+
+    this->length = position - this->buffer.data();
+
+    return;
+}
+
+void RowFormatter::make_room(size_t chars)
+{
+    if (this->buffer.size() - this->length < chars)
+    {
+        this->buffer.resize(2 * (this->length + chars));
+    }
+
+    return;
+}
@@ -0,0 +1,379 @@
+/**
+ * @file    SGP4.cpp
+ *
+ * @details implements the SGP4 orbit propagator as defined in SGP4.hpp. Variable names follow
+ *          the reference implementation of Vallado et al. so the two can be compared.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <cctype>
+#include <cmath>
+#include <stdexcept>
+
+#include "SGP4.hpp"
+
+namespace
+{
+    constexpr double two_pi    = 2 * M_PI;
+    constexpr double deg_2_rad = M_PI / 180;
+    constexpr double x2o3      = 2.0 / 3.0;
+
+    /* mean motion of a circular orbit one earth radius in size, in 1/min */
+    const double xke        = 60.0 / std::sqrt(SGP4::earth_radius * SGP4::earth_radius * SGP4::earth_radius / SGP4::earth_mu);
+    const double vkmpersec  = SGP4::earth_radius * xke / 60.0;
+    constexpr double j3oj2  = SGP4::j3 / SGP4::j2;
+
+    /**
+     * @name    checksum_valid
+     *
+     * @returns whether the last character of a TLE line is the sum of its digits, with minus signs
+     *          counting as one, modulo 10.
+    **/
+    bool checksum_valid(const std::string &line)
+    {
+        int sum = 0;
+        for (size_t i = 0; i < 68; i++)
+        {
+            if (std::isdigit(static_cast<unsigned char>(line[i])))
+            {
+                sum += line[i] - '0';
+            }
+            else if ('-' == line[i])
+            {
+                sum += 1;
+            }
+        }
+
+        return (sum % 10) == (line[68] - '0');
+    }
+
+    /**
+     * @name    parse_exponent_field
+     *
+     * @returns the value of a TLE field with an implied leading decimal point and a power of ten
+     *          exponent, such as " 38792-4" for 0.38792e-4.
+    **/
+    double parse_exponent_field(const std::string &field)
+    {
+        const double mantissa = std::stod("0." + field.substr(1, 5));
+        const int    exponent = std::stoi(field.substr(6, 2));
+
+        return (('-' == field[0]) ? -mantissa : mantissa) * std::pow(10.0, exponent);
+    }
+
+    /**
+     * @name    julian_date
+     *
+     * @returns the Julian date at the start of January 1st of a year, in the Gregorian calendar.
+    **/
+    double julian_date(int year)
+    {
+        const int y = year + 4799;
+        const int day_number = 1 + 306 + 365 * y + y / 4 - y / 100 + y / 400 - 32045;
+
+        return day_number - 0.5;
+    }
+}
+
+SGP4::SGP4(const std::string &line_1, const std::string &line_2) : SGP4(parse_tle(line_1, line_2)) {}
+
+SGP4::SGP4(const tle_elements &elements) : elements(elements)
+{
+    this->inclination    = elements.inclination * deg_2_rad;
+    this->raan           = elements.raan * deg_2_rad;
+    this->eccentricity   = elements.eccentricity;
+    this->arg_of_perigee = elements.arg_of_perigee * deg_2_rad;
+    this->mean_anomaly   = elements.mean_anomaly * deg_2_rad;
+    this->bstar          = elements.bstar;
+
+    const double no_kozai = elements.mean_motion * two_pi / 1440.0;
+    const double ecco     = this->eccentricity;
+    const double inclo    = this->inclination;
+    const double argpo    = this->arg_of_perigee;
+
+    if ((no_kozai <= 0) || (ecco < 0) || (ecco >= 1))
+    {
+        throw invalid_tle("TLE mean motion or eccentricity is out of range.");
+    }
+
+    // recover the original mean motion and semi-major axis from the Kozai mean motion of the TLE
+    const double eccsq   = ecco * ecco;
+    const double omeosq  = 1 - eccsq;
+    const double rteosq  = std::sqrt(omeosq);
+    const double cosio   = std::cos(inclo);
+    const double cosio2  = cosio * cosio;
+    const double ak      = std::pow(xke / no_kozai, x2o3);
+    const double d1      = 0.75 * j2 * (3 * cosio2 - 1) / (rteosq * omeosq);
+    double       del     = d1 / (ak * ak);
+    const double adel    = ak * (1 - del * del - del * (1.0 / 3.0 + 134 * del * del / 81));
+    del                  = d1 / (adel * adel);
+    this->mean_motion    = no_kozai / (1 + del);
+
+    const double no      = this->mean_motion;
+    const double ao      = std::pow(xke / no, x2o3);
+    const double sinio   = std::sin(inclo);
+    const double po      = ao * omeosq;
+    const double con42   = 1 - 5 * cosio2;
+    this->con41          = -con42 - cosio2 - cosio2;
+    const double posq    = po * po;
+    const double rp      = ao * (1 - ecco);
+
+    if (two_pi / no >= 225)
+    {
+        throw invalid_tle("TLE is a deep space orbit, which is not supported.");
+    }
+
+    // drag is modelled with a density function that depends on the height of the perigee
+    const double ss      = 78 / earth_radius + 1;
+    double       sfour   = ss;
+    double       qzms24  = std::pow((120 - 78) / earth_radius, 4);
+    const double perige  = (rp - 1) * earth_radius;
+    if (perige < 156)
+    {
+        sfour = (perige < 98) ? 20 : perige - 78;
+        qzms24 = std::pow((120 - sfour) / earth_radius, 4);
+        sfour  = sfour / earth_radius + 1;
+    }
+    this->simple = (rp < 220 / earth_radius + 1);
+
+    const double pinvsq  = 1 / posq;
+    const double tsi     = 1 / (ao - sfour);
+    this->eta            = ao * ecco * tsi;
+    const double etasq   = this->eta * this->eta;
+    const double eeta    = ecco * this->eta;
+    const double psisq   = std::fabs(1 - etasq);
+    const double coef    = qzms24 * std::pow(tsi, 4);
+    const double coef1   = coef / std::pow(psisq, 3.5);
+    const double cc2     = coef1 * no * (ao * (1 + 1.5 * etasq + eeta * (4 + etasq)) +
+                           0.375 * j2 * tsi / psisq * this->con41 * (8 + 3 * etasq * (8 + etasq)));
+    this->cc1            = this->bstar * cc2;
+    const double cc3     = (ecco > 1.0e-4) ? -2 * coef * tsi * j3oj2 * no * sinio / ecco : 0;
+    this->x1mth2         = 1 - cosio2;
+    this->cc4            = 2 * no * coef1 * ao * omeosq *
+                           (this->eta * (2 + 0.5 * etasq) + ecco * (0.5 + 2 * etasq) -
+                            j2 * tsi / (ao * psisq) *
+                            (-3 * this->con41 * (1 - 2 * eeta + etasq * (1.5 - 0.5 * eeta)) +
+                             0.75 * this->x1mth2 * (2 * etasq - eeta * (1 + etasq)) * std::cos(2 * argpo)));
+    this->cc5            = 2 * coef1 * ao * omeosq * (1 + 2.75 * (etasq + eeta) + eeta * etasq);
+
+    // secular rates of the mean anomaly, argument of perigee and node from the earth's oblateness
+    const double cosio4  = cosio2 * cosio2;
+    const double temp1   = 1.5 * j2 * pinvsq * no;
+    const double temp2   = 0.5 * temp1 * j2 * pinvsq;
+    const double temp3   = -0.46875 * j4 * pinvsq * pinvsq * no;
+    this->mdot           = no + 0.5 * temp1 * rteosq * this->con41 +
+                           0.0625 * temp2 * rteosq * (13 - 78 * cosio2 + 137 * cosio4);
+    this->argpdot        = -0.5 * temp1 * con42 + 0.0625 * temp2 * (7 - 114 * cosio2 + 395 * cosio4) +
+                           temp3 * (3 - 36 * cosio2 + 49 * cosio4);
+    const double xhdot1  = -temp1 * cosio;
+    this->nodedot        = xhdot1 + (0.5 * temp2 * (4 - 19 * cosio2) + 2 * temp3 * (3 - 7 * cosio2)) * cosio;
+    this->omgcof         = this->bstar * cc3 * std::cos(argpo);
+    this->xmcof          = (ecco > 1.0e-4) ? -x2o3 * coef * this->bstar / eeta : 0;
+    this->nodecf         = 3.5 * omeosq * xhdot1 * this->cc1;
+    this->t2cof          = 1.5 * this->cc1;
+
+    // avoid a division by zero for an inclination of 180 degrees
+    const double cosio_1 = (std::fabs(cosio + 1) > 1.5e-12) ? (1 + cosio) : 1.5e-12;
+    this->xlcof          = -0.25 * j3oj2 * sinio * (3 + 5 * cosio) / cosio_1;
+    this->aycof          = -0.5 * j3oj2 * sinio;
+    this->delmo          = std::pow(1 + this->eta * std::cos(this->mean_anomaly), 3);
+    this->sinmao         = std::sin(this->mean_anomaly);
+    this->x7thm1         = 7 * cosio2 - 1;
+
+    this->d2 = this->d3 = this->d4 = 0;
+    this->t3cof = this->t4cof = this->t5cof = 0;
+    if (!this->simple)
+    {
+        const double cc1sq = this->cc1 * this->cc1;
+        this->d2           = 4 * ao * tsi * cc1sq;
+        const double temp  = this->d2 * tsi * this->cc1 / 3;
+        this->d3           = (17 * ao + sfour) * temp;
+        this->d4           = 0.5 * temp * ao * tsi * (221 * ao + 31 * sfour) * this->cc1;
+        this->t3cof        = this->d2 + 2 * cc1sq;
+        this->t4cof        = 0.25 * (3 * this->d3 + this->cc1 * (12 * this->d2 + 10 * cc1sq));
+        this->t5cof        = 0.2 * (3 * this->d4 + 12 * this->cc1 * this->d3 + 6 * this->d2 * this->d2 +
+                                    15 * cc1sq * (2 * this->d2 + cc1sq));
+    }
+}
+
+tle_elements SGP4::parse_tle(const std::string &line_1, const std::string &line_2)
+{
+    if ((line_1.size() < 69) || (line_2.size() < 69) || ('1' != line_1[0]) || ('2' != line_2[0]))
+    {
+        throw invalid_tle("TLE lines must be 69 characters, starting with their line number.");
+    }
+
+    if (!checksum_valid(line_1) || !checksum_valid(line_2))
+    {
+        throw invalid_tle("TLE checksum does not match.");
+    }
+
+    tle_elements elements;
+    try
+    {
+        elements.satellite_number = std::stoul(line_1.substr(2, 5));
+        if (elements.satellite_number != std::stoul(line_2.substr(2, 5)))
+        {
+            throw invalid_tle("TLE lines are for different satellites.");
+        }
+
+        // two digit years from 57 are in the 1900s, the first year of the catalogue
+        const int year    = std::stoi(line_1.substr(18, 2));
+        elements.epoch    = julian_date((year < 57) ? 2000 + year : 1900 + year) + std::stod(line_1.substr(20, 12)) - 1;
+        elements.bstar    = parse_exponent_field(line_1.substr(53, 8));
+
+        elements.inclination    = std::stod(line_2.substr(8, 8));
+        elements.raan           = std::stod(line_2.substr(17, 8));
+        elements.eccentricity   = std::stod("0." + line_2.substr(26, 7));
+        elements.arg_of_perigee = std::stod(line_2.substr(34, 8));
+        elements.mean_anomaly   = std::stod(line_2.substr(43, 8));
+        elements.mean_motion    = std::stod(line_2.substr(52, 11));
+    }
+    catch (const std::logic_error &e)
+    {
+        throw invalid_tle("TLE has a field that is not a number.");
+    }
+
+    return elements;
+}
+
+void SGP4::propagate(double minutes, Eigen::Vector3d &position, Eigen::Vector3d &velocity) const
+{
+    const double t = minutes;
+
+    // secular effects of gravity and drag
+    const double xmdf   = this->mean_anomaly + this->mdot * t;
+    const double argpdf = this->arg_of_perigee + this->argpdot * t;
+    const double nodedf = this->raan + this->nodedot * t;
+    double       argpm  = argpdf;
+    double       mm     = xmdf;
+    const double t2     = t * t;
+    double       nodem  = nodedf + this->nodecf * t2;
+    double       tempa  = 1 - this->cc1 * t;
+    double       tempe  = this->bstar * this->cc4 * t;
+    double       templ  = this->t2cof * t2;
+
+    if (!this->simple)
+    {
+        const double delomg = this->omgcof * t;
+        const double delm   = this->xmcof * (std::pow(1 + this->eta * std::cos(xmdf), 3) - this->delmo);
+        const double temp   = delomg + delm;
+        mm                  = xmdf + temp;
+        argpm               = argpdf - temp;
+        const double t3     = t2 * t;
+        const double t4     = t3 * t;
+        tempa               = tempa - this->d2 * t2 - this->d3 * t3 - this->d4 * t4;
+        tempe               = tempe + this->bstar * this->cc5 * (std::sin(mm) - this->sinmao);
+        templ               = templ + this->t3cof * t3 + t4 * (this->t4cof + t * this->t5cof);
+    }
+
+    const double am = std::pow(xke / this->mean_motion, x2o3) * tempa * tempa;
+    const double nm = xke / std::pow(am, 1.5);
+    double       em = this->eccentricity - tempe;
+    if ((em >= 1) || (em < -0.001))
+    {
+        throw orbit_propagation_error("Orbit has decayed or become unbound.");
+    }
+    em = std::max(em, 1.0e-6);
+
+    mm                 = mm + this->mean_motion * templ;
+    const double xlm   = std::fmod(mm + argpm + nodem, two_pi);
+    nodem              = std::fmod(nodem, two_pi);
+    argpm              = std::fmod(argpm, two_pi);
+    mm                 = std::fmod(xlm - argpm - nodem, two_pi);
+
+    // long period periodics
+    const double sinip = std::sin(this->inclination);
+    const double cosip = std::cos(this->inclination);
+    const double axnl  = em * std::cos(argpm);
+    double       temp  = 1 / (am * (1 - em * em));
+    const double aynl  = em * std::sin(argpm) + temp * this->aycof;
+    const double xl    = mm + argpm + nodem + temp * this->xlcof * axnl;
+
+    // solve kepler's equation
+    const double u     = std::fmod(xl - nodem, two_pi);
+    double       eo1   = u;
+    double       tem5  = 9999.9;
+    double       sineo1 = 0;
+    double       coseo1 = 0;
+    for (int ktr = 0; (std::fabs(tem5) >= 1.0e-12) && (ktr < 10); ktr++)
+    {
+        sineo1 = std::sin(eo1);
+        coseo1 = std::cos(eo1);
+        tem5   = 1 - coseo1 * axnl - sineo1 * aynl;
+        tem5   = (u - aynl * coseo1 + axnl * sineo1 - eo1) / tem5;
+        tem5   = std::max(-0.95, std::min(tem5, 0.95));
+        eo1    = eo1 + tem5;
+    }
+
+    // short period periodics
+    const double ecose  = axnl * coseo1 + aynl * sineo1;
+    const double esine  = axnl * sineo1 - aynl * coseo1;
+    const double el2    = axnl * axnl + aynl * aynl;
+    const double pl     = am * (1 - el2);
+    if (pl < 0)
+    {
+        throw orbit_propagation_error("Orbit semi-latus rectum is negative.");
+    }
+
+    const double rl     = am * (1 - ecose);
+    const double rdotl  = std::sqrt(am) * esine / rl;
+    const double rvdotl = std::sqrt(pl) / rl;
+    const double betal  = std::sqrt(1 - el2);
+    temp                = esine / (1 + betal);
+    const double sinu   = am / rl * (sineo1 - aynl - axnl * temp);
+    const double cosu   = am / rl * (coseo1 - axnl + aynl * temp);
+    double       su     = std::atan2(sinu, cosu);
+    const double sin2u  = (cosu + cosu) * sinu;
+    const double cos2u  = 1 - 2 * sinu * sinu;
+    temp                = 1 / pl;
+    const double temp1  = 0.5 * j2 * temp;
+    const double temp2  = temp1 * temp;
+
+    const double mrt    = rl * (1 - 1.5 * temp2 * betal * this->con41) + 0.5 * temp1 * this->x1mth2 * cos2u;
+    su                  = su - 0.25 * temp2 * this->x7thm1 * sin2u;
+    const double xnode  = nodem + 1.5 * temp2 * cosip * sin2u;
+    const double xinc   = this->inclination + 1.5 * temp2 * cosip * sinip * cos2u;
+    const double mvt    = rdotl - nm * temp1 * this->x1mth2 * sin2u / xke;
+    const double rvdot  = rvdotl + nm * temp1 * (this->x1mth2 * cos2u + 1.5 * this->con41) / xke;
+
+    if (mrt < 1)
+    {
+        throw orbit_propagation_error("Orbit has decayed below the surface of the earth.");
+    }
+
+    // orientation vectors of the orbit
+    const double sinsu = std::sin(su);
+    const double cossu = std::cos(su);
+    const double snod  = std::sin(xnode);
+    const double cnod  = std::cos(xnode);
+    const double sini  = std::sin(xinc);
+    const double cosi  = std::cos(xinc);
+    const double xmx   = -snod * cosi;
+    const double xmy   = cnod * cosi;
+
+    const Eigen::Vector3d radial(xmx * sinsu + cnod * cossu, xmy * sinsu + snod * cossu, sini * sinsu);
+    const Eigen::Vector3d along(xmx * cossu - cnod * sinsu, xmy * cossu - snod * sinsu, sini * cossu);
+
+    position = (mrt * earth_radius) * radial;
+    velocity = vkmpersec * (mvt * radial + rvdot * along);
+}
+
+void SGP4::propagate(const Eigen::ArrayXd &minutes, Eigen::Matrix3Xd &positions, Eigen::Matrix3Xd &velocities) const
+{
+    positions.resize(3, minutes.size());
+    velocities.resize(3, minutes.size());
+
+    // the terms that only depend on the elements are shared, so each time only costs its own terms
+    Eigen::Vector3d position;
+    Eigen::Vector3d velocity;
+    for (Eigen::Index i = 0; i < minutes.size(); i++)
+    {
+        this->propagate(minutes(i), position, velocity);
+        positions.col(i)  = position;
+        velocities.col(i) = velocity;
+    }
+}
@@ -14,10 +14,11 @@
 #include "SensorActuatorFactory.hpp"
 #include "ConfigurationSingleton.hpp"
 #include "Simulator.hpp"
+#include "MagneticField.hpp"
+#include "SGP4.hpp"
 #include <iostream>
 
-std::shared_ptr<Sensor> SensorActuatorFactory::GetSensor(const std::string &name, Simulator* sim) {
-    auto &config = Configuration::GetInstance();
+std::shared_ptr<Sensor> SensorActuatorFactory::GetSensor(Configuration &config, const std::string &name, Simulator* sim) {
     const auto & sensor = config.GetSensorConfig(name);
 
     std::shared_ptr<Sensor> ret;
@@ -33,12 +34,21 @@ std::shared_ptr<Sensor> SensorActuatorFactory::GetSensor(const std::string &name
     case SensorType::Gyroscope:
         ret = std::make_shared<Gyroscope>(timestamp(sensor->pollingTime, 0), sim, sensor->position);
         break;
+    case SensorType::Magnetometer:
+        ret = std::make_shared<Magnetometer>(timestamp(sensor->pollingTime, 0), sim, sensor->position);
+        break;
+    case SensorType::SunSensor:
+        {
+            const SunSensorConfig* sun_sensor = dynamic_cast<const SunSensorConfig*>(sensor.get());
+            uint32_t handle = sim->get_sun_sensor_handle(name);
+            ret = std::make_shared<SunSensor>(timestamp(sun_sensor->pollingTime, 0), sim, sun_sensor->position, sun_sensor->axis, sun_sensor->normal, sun_sensor->maxVoltage, handle);
+            break;
+        }
     }
     return ret;
 }
 
-std::shared_ptr<Actuator> SensorActuatorFactory::GetActuator(const std::string &name, Simulator* sim) {
-    auto &config = Configuration::GetInstance();
+std::shared_ptr<Actuator> SensorActuatorFactory::GetActuator(Configuration &config, const std::string &name, Simulator* sim) {
     const auto& actu = config.GetActuatorConfig(name);
     std::shared_ptr<Actuator> ret ;
 
@@ -67,9 +77,40 @@ std::shared_ptr<Actuator> SensorActuatorFactory::GetActuator(const std::string &
             initial_vals.position = 0; //this is unused
             initial_vals.time = 0; //this is unused
             initial_vals.velocity = reac->velocity;
-            ret = std::make_shared<Reaction_wheel>(timestamp(reac->pollingTime, 0), sim, reac->position, max, min, initial_vals, reac->axisOfRotation, reac->momentOfInertia);
+            /* the wheel is found once here, and the simulator is then called with its handle */
+            uint32_t handle = sim->get_reaction_wheel_handle(name);
+            ret = std::make_shared<Reaction_wheel>(timestamp(reac->pollingTime, 0), sim, reac->position, max, min, initial_vals, reac->axisOfRotation, reac->momentOfInertia, handle);
+            break;
+        }
+    case ActuatorType::Magnetorquer:
+        {
+            const MagnetorquerConfig* torquer = dynamic_cast<const MagnetorquerConfig*>(actu.get());
+            uint32_t handle = sim->get_magnetorquer_handle(name);
+            ret = std::make_shared<Magnetorquer>(timestamp(torquer->pollingTime, 0), sim, torquer->position, torquer->axis, torquer->maxDipole, handle);
             break;
         }
     }
     return ret;
 }
+
+std::function<Eigen::Vector3f(timestamp)> SensorActuatorFactory::GetFieldReference(Configuration &config) {
+    const sim_orbit &orbit = config.GetOrbit();
+    if (!orbit.enabled)
+    {
+        return {};
+    }
+
+    /* the orbit is propagated the same way as in the simulator, from the start time of the config */
+    std::shared_ptr<SGP4> orbit_model = std::make_shared<SGP4>(orbit.elements);
+    std::shared_ptr<MagneticField> field_model = std::make_shared<MagneticField>();
+    const double start_time = orbit.start_time;
+    const double epoch      = orbit.elements.epoch;
+
+    return [orbit_model, field_model, start_time, epoch](timestamp time) -> Eigen::Vector3f {
+        const double minutes = start_time + time.microseconds() / 60.0e6;
+        Eigen::Vector3d position;
+        Eigen::Vector3d velocity;
+        orbit_model->propagate(minutes, position, velocity);
+        return field_model->field(position, epoch + minutes / 1440.0).cast<float>();
+    };
+}
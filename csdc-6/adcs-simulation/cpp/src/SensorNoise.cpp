@@ -0,0 +1,121 @@
+/**
+ * @file    SensorNoise.cpp
+ *
+ * @details implements the sensor error models as defined in SensorNoise.hpp
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <cmath>
+
+#include "DynamicsModel.hpp"
+#include "SensorNoise.hpp"
+
+CounterRng::counter CounterRng::generate(counter ctr, key k)
+{
+    for (int round = 0; round < 10; round++)
+    {
+        const uint64_t product_0 = static_cast<uint64_t>(0xD2511F53) * ctr[0];
+        const uint64_t product_1 = static_cast<uint64_t>(0xCD9E8D57) * ctr[2];
+
+        ctr = { static_cast<uint32_t>(product_1 >> 32) ^ ctr[1] ^ k[0], static_cast<uint32_t>(product_1),
+                static_cast<uint32_t>(product_0 >> 32) ^ ctr[3] ^ k[1], static_cast<uint32_t>(product_0) };
+
+        k[0] += 0x9E3779B9;
+        k[1] += 0xBB67AE85;
+    }
+
+    return ctr;
+}
+
+Eigen::Array4f CounterRng::normals(const counter &ctr, const key &k)
+{
+    const counter bits = generate(ctr, k);
+
+    // the top 24 bits of each word, centred in their interval so 0 is never drawn
+    Eigen::Array4f uniform;
+    for (int i = 0; i < 4; i++)
+    {
+        uniform(i) = (static_cast<float>(bits[i] >> 8) + 0.5f) * (1.0f / 16777216.0f);
+    }
+
+    // Box-Muller on scalar pairs. Two element Eigen arrays are loaded as whole SSE registers by
+    // the vectorized functions, which GCC warns about in optimized builds
+    Eigen::Array4f result;
+    for (int i = 0; i < 2; i++)
+    {
+        const float radius = std::sqrt(-2.0f * std::log(uniform(i)));
+        const float angle  = static_cast<float>(2 * M_PI) * uniform(i + 2);
+        result(i)     = radius * std::cos(angle);
+        result(i + 2) = radius * std::sin(angle);
+    }
+    return result;
+}
+
+SensorNoise::SensorNoise(const sensor_noise &model, uint64_t seed, uint32_t sensor_id) : model(model)
+{
+    this->enabled = (0 != model.white_noise) || (0 != model.bias_random_walk) || (0 != model.initial_bias) ||
+                    (0 != model.quantization) || !model.scale_factor.isZero(0) || !model.misalignment.isZero(0) ||
+                    (0 != model.attitude_noise);
+
+    Eigen::Matrix3f misalignment;
+    misalignment <<                       1, -model.misalignment.z(),  model.misalignment.y(),
+                     model.misalignment.z(),                       1, -model.misalignment.x(),
+                    -model.misalignment.y(),  model.misalignment.x(),                       1;
+    this->transform = (Eigen::Vector3f::Ones() + model.scale_factor).asDiagonal() * misalignment;
+
+    this->stream   = { static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) };
+    this->position = { 0, 0, sensor_id, 0 };
+
+    // sample 0 of the stream is the initial bias
+    this->bias = model.initial_bias * this->draw().head<3>().matrix();
+}
+
+Eigen::Vector3f SensorNoise::sample(const Eigen::Vector3f &truth, timestamp time)
+{
+    if (!this->enabled)
+    {
+        return truth;
+    }
+
+    this->position[0]++;
+    this->position[1] = 0;
+
+    const Eigen::Array4f walk  = this->draw();
+    const Eigen::Array4f white = this->draw();
+
+    const float elapsed = static_cast<float>(time - this->last_sample);
+    this->last_sample = time;
+    if (0 < elapsed)
+    {
+        this->bias += this->model.bias_random_walk * std::sqrt(elapsed) * walk.head<3>().matrix();
+    }
+
+    Eigen::Vector3f measured = this->transform * truth + this->bias + this->model.white_noise * white.head<3>().matrix();
+    if (0 < this->model.quantization)
+    {
+        measured = (measured.array() / this->model.quantization).round() * this->model.quantization;
+    }
+
+    return measured;
+}
+
+Eigen::Vector3f SensorNoise::sample_attitude(const Eigen::Vector3f &truth)
+{
+    if (0 == this->model.attitude_noise)
+    {
+        return truth;
+    }
+
+    const Eigen::Vector3f error = this->model.attitude_noise * this->draw().head<3>().matrix();
+    return DynamicsModel::log(DynamicsModel::exp(truth) * DynamicsModel::exp(error));
+}
+
+Eigen::Array4f SensorNoise::draw()
+{
+    const Eigen::Array4f result = CounterRng::normals(this->position, this->stream);
+    this->position[1]++;
+    return result;
+}
@@ -10,13 +10,17 @@
  *
 **/
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iostream>
 
 #include "ConfigurationSingleton.hpp"
+#include "Environment.hpp"
 #include "SensorActuatorFactory.hpp"
 #include "PointingModeController.hpp"
 #include "Simulator.hpp"
+#include "SunSensorModel.hpp"
 
 Simulator::Simulator(Messenger *messenger)
 {
@@ -24,9 +28,15 @@ Simulator::Simulator(Messenger *messenger)
     {
         this->messenger = messenger;
     }
+
+    this->derivative = [this](const Eigen::VectorXf &state, Eigen::VectorXf &derivative)
+    {
+        this->dynamics.calculate_derivative(state, derivative);
+    };
 }
 
-void Simulator::init(sim_config initial_values, timestamp timeout, timestamp initial_timestep, bool variableTimestep, timestamp max_timestep, timestamp min_timestep)
+void Simulator::init(sim_config initial_values, timestamp timeout, timestamp initial_timestep, bool variableTimestep, timestamp max_timestep, timestamp min_timestep,
+                     TimeMode time_mode, controller_cost_table call_costs, IntegratorType integrator_type)
 {
     /* TODO may need a check here**/
     this->system_vals = initial_values;
@@ -34,18 +44,213 @@ void Simulator::init(sim_config initial_values, timestamp timeout, timestamp ini
 
     this->simulation_time = 0;
     this->timestep_length = initial_timestep;
-    this->last_called     = -1;
+
+    this->time_mode               = time_mode;
+    this->call_costs              = call_costs;
+    this->pending_controller_time = 0;
+    this->last_returned           = std::chrono::steady_clock::now();
 
     this->variableTimestep = variableTimestep;
     this->max_timestep     = max_timestep;
     this->min_timestamp    = min_timestep;
 
+    this->integrator        = Integrator::create(integrator_type);
+    this->integrator->set_kinematic_states(3, 3);
+    this->proposed_timestep = this->limit_timestep(initial_timestep);
+    this->dynamics          = DynamicsModel(initial_values);
+    this->state.resize(this->dynamics.state_size());
+
+    this->orbit_model.reset();
+    if (initial_values.orbit.enabled)
+    {
+        this->orbit_model = std::make_unique<SGP4>(initial_values.orbit.elements);
+    }
+    this->update_orbit();
+
+    const sim_disturbances &disturbance_config = initial_values.disturbances;
+    const bool disturbed = disturbance_config.gravity_gradient || (disturbance_config.drag_area > 0) ||
+                           (disturbance_config.solar_area > 0) || !disturbance_config.residual_dipole.isZero();
+    this->disturbances.reset();
+    if (disturbed && initial_values.orbit.enabled)
+    {
+        this->disturbances = std::make_unique<DisturbanceTorques>(disturbance_config, initial_values.orbit);
+    }
+    else if (disturbed)
+    {
+        messenger->send_message("Disturbance torques need an Orbit, they will not be modelled.", text_colour.yellow);
+    }
+
+    this->gyroscope_noise     = SensorNoise(initial_values.gyroscope.noise, initial_values.noise_seed,
+                                            static_cast<uint32_t>(SensorType::Gyroscope));
+    this->accelerometer_noise = SensorNoise(initial_values.accelerometer.noise, initial_values.noise_seed,
+                                            static_cast<uint32_t>(SensorType::Accelerometer));
+    this->magnetometer_noise  = SensorNoise(initial_values.magnetometer.noise, initial_values.noise_seed,
+                                            static_cast<uint32_t>(SensorType::Magnetometer));
+
+    // each sun sensor has its own noise stream
+    this->sun_sensor_noise.clear();
+    for (size_t i = 0; i < initial_values.sun_sensors.size(); i++)
+    {
+        this->sun_sensor_noise.emplace_back(initial_values.sun_sensors[i].noise, initial_values.noise_seed,
+                                            static_cast<uint32_t>(SensorType::SunSensor) | static_cast<uint32_t>(i << 8));
+    }
+
+    if (initial_values.magnetometer.enabled && !initial_values.orbit.enabled)
+    {
+        messenger->send_message("The magnetometer needs an Orbit, it will measure no field.", text_colour.yellow);
+    }
+    if ((initial_values.sun_sensors.size() > 0) && !initial_values.orbit.enabled)
+    {
+        messenger->send_message("Sun sensors need an Orbit, they will not see the sun.", text_colour.yellow);
+    }
+    if ((initial_values.magnetorquers.size() > 0) && !initial_values.orbit.enabled)
+    {
+        messenger->send_message("Magnetorquers need an Orbit, they will apply no torque.", text_colour.yellow);
+    }
+
     messenger->send_message("Starting simulation, timeout: " + this->timeout.pretty_string());
     messenger->start_new_sim(initial_values.reaction_wheels.size());
 }
 
-timestamp Simulator::update_simulation() {
-    timestamp time_passed = this->determine_time_passed();
+void Simulator::init(Configuration &config)
+{
+    timestamp timeout(config.getTimeout(),0);
+    timestamp initial_timestep = timestamp(config.GetTimestepInMilliSeconds() / 1000.0f);
+    if (0 == initial_timestep)
+    {
+        initial_timestep = timestamp(1,0);
+    }
+
+    bool variableTimestep = config.GetTimestepDecision();
+    timestamp max_timestep = timestamp(0,0);
+    timestamp min_timestamp = timestamp(0,0);
+
+    if (true == variableTimestep)
+    {
+        max_timestep = timestamp(config.GetMaxTimestep() / 1000.0f);
+        min_timestamp = timestamp(config.GetMinTimestep() / 1000.0f);
+    }
+
+    controller_cost_table call_costs;
+    for (size_t call = 0; call < num_controller_calls; call++)
+    {
+        call_costs.at(call) = timestamp(config.GetControllerCostsInMilliseconds().at(call) / 1000.0f);
+    }
+
+    this->init(get_sim_config(config), timeout, initial_timestep, variableTimestep, max_timestep, min_timestamp,
+               config.GetTimeMode(), call_costs, config.GetIntegratorType());
+}
+
+sim_config Simulator::get_sim_config(Configuration &config)
+{
+    sim_config initial_values;
+    Satellite temp;
+    initial_values.satellite.alpha_b   = Eigen::Vector3f::Zero();
+    initial_values.satellite.omega_b   = config.GetSatelliteVelocity();
+    initial_values.satellite.theta_b   = config.GetSatellitePosition();
+    initial_values.satellite.attitude_b = DynamicsModel::exp(initial_values.satellite.theta_b);
+    initial_values.satellite.inertia_b = config.GetSatelliteMoment();
+    initial_values.noise_seed          = config.GetNoiseSeed();
+    initial_values.orbit               = config.GetOrbit();
+    initial_values.disturbances        = config.GetDisturbances();
+
+    for (const auto &sensor : config.GetSensorConfigs())
+    {
+        const auto & sensor_config = config.GetSensorConfig(sensor.first);
+        switch(sensor_config->type)
+        {
+            case SensorType::Accelerometer:
+                initial_values.accelerometer.position = sensor_config->position;
+                initial_values.accelerometer.measurement = Eigen::Vector3f::Zero();
+                initial_values.accelerometer.noise = sensor_config->noise;
+                break;
+            case SensorType::Gyroscope:
+                initial_values.gyroscope.position = sensor_config->position;
+                initial_values.gyroscope.alpha = Eigen::Vector3f::Zero();
+                initial_values.gyroscope.omega = Eigen::Vector3f::Zero();
+                initial_values.gyroscope.theta = Eigen::Vector3f::Zero();
+                initial_values.gyroscope.noise = sensor_config->noise;
+                break;
+            case SensorType::Magnetometer:
+                initial_values.magnetometer.enabled = true;
+                initial_values.magnetometer.position = sensor_config->position;
+                initial_values.magnetometer.measurement = Eigen::Vector3f::Zero();
+                initial_values.magnetometer.noise = sensor_config->noise;
+                break;
+            case SensorType::SunSensor:
+            {
+                const SunSensorConfig *sun_config = dynamic_cast<const SunSensorConfig*>(sensor_config.get());
+                const Eigen::Vector3f normal = sun_config->normal.normalized();
+                const Eigen::Vector3f axis   = sun_config->axis - sun_config->axis.dot(normal) * normal;
+                if ((axis.norm() < 1e-3f * sun_config->axis.norm()) || (sun_config->maxVoltage <= 0))
+                {
+                    throw invalid_adcs_param("Sun sensor axis must be in its plane, and its max voltage positive.");
+                }
+
+                sim_sun_sensor sun_sensor;
+                sun_sensor.name          = sensor.first;
+                sun_sensor.position      = sun_config->position;
+                sun_sensor.axis          = axis.normalized();
+                sun_sensor.perpendicular = normal.cross(sun_sensor.axis);
+                sun_sensor.max_voltage   = sun_config->maxVoltage;
+                sun_sensor.noise         = sun_config->noise;
+                initial_values.sun_sensors.push_back(sun_sensor);
+                break;
+            }
+        }
+    }
+
+    std::vector<const ReactionWheelConfig *> reaction_configs;
+    std::vector<std::string> reaction_names;
+    std::vector<const MagnetorquerConfig *> magnetorquer_configs;
+    std::vector<std::string> magnetorquer_names;
+    for (const auto &actuator : config.GetActuatorConfigs()) {
+        const auto & actuator_config = config.GetActuatorConfig(actuator.first);
+        switch(actuator_config->type)
+        {
+            case ActuatorType::ReactionWheel:
+                reaction_configs.push_back(dynamic_cast<const ReactionWheelConfig*>(actuator_config.get()));
+                reaction_names.push_back(actuator.first);
+                break;
+            case ActuatorType::Magnetorquer:
+                magnetorquer_configs.push_back(dynamic_cast<const MagnetorquerConfig*>(actuator_config.get()));
+                magnetorquer_names.push_back(actuator.first);
+                break;
+        }
+    }
+
+    sim_wheel_bank &wheels = initial_values.reaction_wheels;
+    wheels.resize(reaction_configs.size());
+    for (size_t i = 0; i < reaction_configs.size(); i++) {
+        const ReactionWheelConfig* reaction_config = reaction_configs[i];
+        wheels.alpha(i)            = reaction_config->acceleration;
+        wheels.omega(i)            = reaction_config->velocity;
+        wheels.inertia(i)          = reaction_config->momentOfInertia;
+        wheels.max_omega(i)        = reaction_config->maxAngVel;
+        wheels.max_alpha(i)        = reaction_config->maxAngAccel;
+        wheels.time_constant(i)    = reaction_config->motorTimeConstant;
+        wheels.coulomb_friction(i) = reaction_config->coulombFriction;
+        wheels.viscous_friction(i) = reaction_config->viscousFriction;
+        wheels.name[i]                 = reaction_names[i];
+        wheels.axis_of_rotation.col(i) = reaction_config->axisOfRotation;
+    }
+    wheels.command = wheels.alpha.min(wheels.max_alpha).max(-wheels.max_alpha);
+    wheels.drive   = wheels.command;
+
+    sim_magnetorquer_bank &magnetorquers = initial_values.magnetorquers;
+    magnetorquers.resize(magnetorquer_configs.size());
+    for (size_t i = 0; i < magnetorquer_configs.size(); i++) {
+        magnetorquers.max_dipole(i)   = magnetorquer_configs[i]->maxDipole;
+        magnetorquers.axis.col(i)     = magnetorquer_configs[i]->axis;
+        magnetorquers.name[i]         = magnetorquer_names[i];
+    }
+    magnetorquers.dipole.setZero();
+
+    return initial_values;
+}
+
+timestamp Simulator::update_simulation(ControllerCall call) {
+    timestamp time_passed = this->determine_time_passed(call);
     this->simulate(time_passed);
 
     return this->simulation_time;
@@ -54,86 +259,164 @@ timestamp Simulator::update_simulation() {
 void Simulator::determine_timestep() 
 {
     //2*max error is defined as 2*0.005 degrees = 0.01 degrees
-    if (true == this->variableTimestep)
+    if ((true == this->variableTimestep) && this->integrator->has_error_estimate())
+    {
+        this->timestep_length = this->proposed_timestep;
+    }
+    else if (true == this->variableTimestep)
     {
-        // formula is: timestep = 2 * error / acceleration. Result is in seconds, *1000 to conver to ms
-        float calculated_timestep_in_ms = (2 * max_error_in_rad)/(this->system_vals.satellite.alpha_b.cwiseAbs().maxCoeff())*1000;
-        timestamp t(calculated_timestep_in_ms,0);
+        // formula is: timestep = 2 * error / acceleration. Result is in seconds.
+        float calculated_timestep_in_s = (2 * max_error_in_rad)/(this->system_vals.satellite.alpha_b.cwiseAbs().maxCoeff());
+        timestamp t(calculated_timestep_in_s);
 
-        this->timestep_length = t;
-        if ((timestep_length > max_timestep))
-        {
-            this->timestep_length = max_timestep;
-        }
-        else if (timestep_length < min_timestamp)
-        {
-            this->timestep_length = min_timestamp;
-        }
+        this->timestep_length = this->limit_timestep(t);
     }
 
     return;
 }
 
+timestamp Simulator::limit_timestep(timestamp t)
+{
+    if (t > max_timestep)
+    {
+        return max_timestep;
+    }
+    else if (t < min_timestamp)
+    {
+        return min_timestamp;
+    }
+
+    return t;
+}
+
 timestamp Simulator::set_adcs_sleep(timestamp duration) {
-    timestamp time_passed = this->determine_time_passed();
+    timestamp time_passed = this->determine_time_passed(ControllerCall::Sleep);
     this->simulate(time_passed + duration);
 
     return this->simulation_time;
 }
 
-timestamp Simulator::determine_time_passed() {
-    if (this->last_called == -1) return 0;
+timestamp Simulator::controller_time()
+{
+    if (TimeMode::RealTime == this->time_mode)
+    {
+        using namespace std::chrono;
+        int64_t us = duration_cast<microseconds>(steady_clock::now() - this->last_returned).count();
+        return this->simulation_time + timestamp::from_microseconds(us);
+    }
+
+    return this->simulation_time + this->pending_controller_time;
+}
+
+timestamp Simulator::determine_time_passed(ControllerCall call) {
+    timestamp time_passed = 0;
+
+    if (TimeMode::RealTime == this->time_mode)
+    {
+        using namespace std::chrono;
+        int64_t us = duration_cast<microseconds>(steady_clock::now() - this->last_returned).count();
+        time_passed = timestamp::from_microseconds(us);
+    }
+    else
+    {
+        time_passed = this->pending_controller_time + this->call_costs.at(static_cast<size_t>(call));
+        this->pending_controller_time = 0;
+    }
 
-    using namespace std::chrono;
-    uint32_t ms = duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
-    timestamp now = (timestamp) ms;
-    timestamp time_passed = now - this->last_called;
-    this->last_called = now;
     return time_passed;
 }
 
+void Simulator::charge_controller_call(ControllerCall call)
+{
+    if (TimeMode::Virtual == this->time_mode)
+    {
+        this->pending_controller_time += this->call_costs.at(static_cast<size_t>(call));
+    }
+
+    return;
+}
+
 void Simulator::simulate(timestamp t) {
     timestamp end = this->simulation_time + t;
 
-    while (this->simulation_time <= end) {
-        this->determine_timestep();
-        this->simulation_time = this->simulation_time + this->timestep_length;
-        this->timestep();
-        this->messenger->update_simulation_state(this->system_vals, this->simulation_time, this->timestep_length);
-        
+    while (true) {
         /* end simulation if the timeout is reached. */
-        if (this->timeout < this->simulation_time)
+        if (this->timeout <= this->simulation_time)
         {
-            this->messenger->write_output_buffer();
+            this->messenger->close_output_file();
             throw simulation_timeout("Timeout reached.");
         }
+
+        if (end <= this->simulation_time)
+        {
+            break;
+        }
+
+        this->determine_timestep();
+
+        /* shorten the step to land exactly on the next event, keeping the proposed step for after it */
+        timestamp next_event = std::min(end, this->timeout);
+        timestamp proposed   = this->proposed_timestep;
+        bool shortened       = (this->simulation_time + this->timestep_length) > next_event;
+        if (shortened)
+        {
+            this->timestep_length = next_event - this->simulation_time;
+        }
+
+        this->timestep();
+
+        if (shortened)
+        {
+            this->proposed_timestep = std::max(this->proposed_timestep, proposed);
+        }
+
+        this->simulation_time = this->simulation_time + this->timestep_length;
+        this->update_orbit();
+        this->messenger->update_simulation_state(this->system_vals, this->simulation_time, this->timestep_length);
     }
+
+    /* control is returned to the control code, so its run time is measured from here */
+    this->last_returned = std::chrono::steady_clock::now();
 }
 
 void Simulator::timestep() {
-    Eigen::Matrix3f inertia_b_inverse = system_vals.satellite.inertia_b.inverse();
-    Eigen::Vector3f sum_rw = Eigen::Vector3f::Zero();
+    if ((nullptr != this->disturbances) || (this->system_vals.magnetorquers.size() > 0))
+    {
+        this->dynamics.set_external_torque(this->external_torque());
+    }
 
-    for (sim_reaction_wheel &wheel : system_vals.reaction_wheels) {
-        
-        // This assumes that w_rw and I_rw are both scalars, and can thus be multiplied by the axis of rotation to achieve the right matrix dimensions
-        // change this if either w_rw or I_rw become a matrix!
-        sum_rw += (wheel.inertia * wheel.alpha * wheel.axis_of_rotation) 
-            + system_vals.satellite.omega_b.cross(wheel.axis_of_rotation * wheel.omega * wheel.inertia);
+    this->pack_state();
 
+    const bool control_error = this->variableTimestep && this->integrator->has_error_estimate();
+    if (control_error)
+    {
+        this->previous_state = this->state;
+    }
 
+    const Eigen::VectorXf &error = this->integrator->step(this->derivative, this->state, (float) this->timestep_length);
+
+    if (control_error)
+    {
+        float ratio = this->error_ratio(error);
+
+        // reject the step and retry with a smaller timestep until the error is small enough
+        while ((ratio > 1) && (this->timestep_length > this->min_timestamp))
+        {
+            this->timestep_length = this->scale_timestep(ratio);
+            this->state = this->previous_state;
+            this->integrator->step(this->derivative, this->state, (float) this->timestep_length);
+            ratio = this->error_ratio(error);
+        }
 
-        // Update reaction wheel velocity 
-        wheel.omega += wheel.alpha * (float) this->timestep_length;
-        //we need to consider alpha but this will be done by the controller
-        //wheel.alpha +=  rw_jerk * (float) this->timestep_length;
+        this->proposed_timestep = this->scale_timestep(ratio);
     }
-    
-    system_vals.satellite.alpha_b = (-inertia_b_inverse * system_vals.satellite.omega_b).cross(system_vals.satellite.inertia_b * system_vals.satellite.omega_b)
-        - inertia_b_inverse * sum_rw;
 
-    system_vals.satellite.omega_b += system_vals.satellite.alpha_b * (float) timestep_length;
-    system_vals.satellite.theta_b += system_vals.satellite.omega_b * (float) timestep_length;
+    this->unpack_state();
+
+    // the acceleration is reported at the start of the timestep, as the sensors would measure it
+    system_vals.satellite.alpha_b = this->integrator->start_derivative().head<3>();
+    sim_wheel_bank &wheels = system_vals.reaction_wheels;
+    wheels.alpha = this->integrator->start_derivative().segment(6, wheels.size()).array();
 
     // Update new internal sensor and actuator values
     system_vals.accelerometer.measurement = system_vals.satellite.alpha_b.cross(system_vals.accelerometer.position);
@@ -145,48 +428,186 @@ void Simulator::timestep() {
     return;
 }
 
-timestamp Simulator::reaction_wheel_update_desired_state(Eigen::Vector3f wheel_position, actuator_state new_target)
+void Simulator::update_orbit()
+{
+    if (nullptr == this->orbit_model)
+    {
+        return;
+    }
+
+    // in double precision, so the orbit stays accurate over long runs
+    sim_orbit &orbit = this->system_vals.orbit;
+    const double minutes = orbit.start_time + this->simulation_time.microseconds() / 60.0e6;
+    this->orbit_model->propagate(minutes, orbit.position, orbit.velocity);
+    orbit.julian_date = orbit.elements.epoch + minutes / 1440.0;
+
+    return;
+}
+
+Eigen::Vector3f Simulator::external_torque()
+{
+    const Satellite &satellite = this->system_vals.satellite;
+
+    Eigen::Vector3f torque = Eigen::Vector3f::Zero();
+    if (nullptr != this->disturbances)
+    {
+        torque += this->disturbances->torque(this->simulation_time, satellite.attitude_b, satellite.inertia_b);
+    }
+
+    const sim_magnetorquer_bank &magnetorquers = this->system_vals.magnetorquers;
+    if ((nullptr != this->orbit_model) && (magnetorquers.size() > 0))
+    {
+        const sim_orbit &orbit = this->system_vals.orbit;
+        const Eigen::Vector3f field  = this->magnetic_field.field(orbit.position, orbit.julian_date).cast<float>();
+        const Eigen::Vector3f dipole = magnetorquers.axis * magnetorquers.dipole.matrix();
+        torque += dipole.cross(satellite.attitude_b.conjugate() * field);
+    }
+
+    return torque;
+}
+
+void Simulator::pack_state()
+{
+    this->state.head<3>()     = system_vals.satellite.omega_b;
+    this->state.segment<3>(3) = Eigen::Vector3f::Zero();
+
+    const sim_wheel_bank &wheels = system_vals.reaction_wheels;
+    this->state.segment(6, wheels.size())                 = wheels.omega.matrix();
+    this->state.segment(6 + wheels.size(), wheels.size()) = wheels.drive.matrix();
+
+    return;
+}
+
+void Simulator::unpack_state()
+{
+    system_vals.satellite.omega_b = this->state.head<3>();
+    Eigen::Quaternionf &attitude_b = system_vals.satellite.attitude_b;
+    attitude_b = (attitude_b * DynamicsModel::exp(this->state.segment<3>(3))).normalized();
+    system_vals.satellite.theta_b = DynamicsModel::log(attitude_b);
+
+    sim_wheel_bank &wheels = system_vals.reaction_wheels;
+    wheels.omega = this->state.segment(6, wheels.size()).array();
+    wheels.drive = this->state.segment(6 + wheels.size(), wheels.size()).array();
+
+    return;
+}
+
+float Simulator::error_ratio(const Eigen::VectorXf &error)
+{
+    float ratio = 0;
+
+    // allowed error is absolute for small values and relative for large ones
+    for (Eigen::Index i = 0; i < error.size(); i++) {
+        float size    = std::max(std::abs(this->state(i)), std::abs(this->previous_state(i)));
+        float allowed = max_error_in_rad + max_relative_error * size;
+        ratio = std::max(ratio, std::abs(error(i)) / allowed);
+    }
+
+    return ratio;
+}
+
+timestamp Simulator::scale_timestep(float error_ratio)
+{
+    // standard step size controller with a safety factor, limited to avoid large jumps
+    float factor = 5;
+    if (error_ratio > 0)
+    {
+        factor = std::clamp(0.9f * std::pow(error_ratio, -1.0f / this->integrator->order()), 0.2f, 5.0f);
+    }
+
+    return this->limit_timestep(timestamp((float) this->timestep_length * factor));
+}
+
+uint32_t Simulator::register_device(timestamp polling_time)
+{
+    this->devices.push_back({polling_time, this->simulation_time + polling_time});
+    return this->devices.size() - 1;
+}
+
+timestamp Simulator::device_time_until_ready(uint32_t handle)
+{
+    this->charge_controller_call(ControllerCall::DeviceReady);
+
+    timestamp remaining = this->devices[handle].next_due - this->controller_time();
+    return (remaining > 0) ? remaining : timestamp();
+}
+
+void Simulator::device_polled(uint32_t handle, timestamp time)
+{
+    this->devices[handle].next_due = time + this->devices[handle].polling_time;
+    return;
+}
+
+uint32_t Simulator::get_reaction_wheel_handle(const std::string &name)
 {
-    // figure out what reaction wheel it is from the position vector
+    for (uint32_t i = 0; i < system_vals.reaction_wheels.size(); i++) {
+        if (system_vals.reaction_wheels.name[i] == name) {
+            return i;
+        }
+    }
 
-    for (sim_reaction_wheel &wheel : system_vals.reaction_wheels) {
-        if (wheel.position.isApprox(wheel_position)) {
-            // Update the target state (For now just change the acceleration to match,
-            // when it reaches it's target position just change accel to 0)
-            wheel.alpha = new_target.acceleration;
+    throw invalid_adcs_param("No simulated reaction wheel with the name of the actuator.");
+}
+
+uint32_t Simulator::get_magnetorquer_handle(const std::string &name)
+{
+    for (uint32_t i = 0; i < system_vals.magnetorquers.size(); i++) {
+        if (system_vals.magnetorquers.name[i] == name) {
+            return i;
         }
     }
 
-    //this->update_simulation();
+    throw invalid_adcs_param("No simulated magnetorquer with the name of the actuator.");
+}
+
+timestamp Simulator::magnetorquer_update_dipole(uint32_t handle, float dipole)
+{
+    sim_magnetorquer_bank &magnetorquers = system_vals.magnetorquers;
+    magnetorquers.dipole(handle) = std::max(-magnetorquers.max_dipole(handle), std::min(dipole, magnetorquers.max_dipole(handle)));
+
+    this->charge_controller_call(ControllerCall::MagnetorquerCommand);
     return this->simulation_time;
 }
 
-actuator_state Simulator::reaction_wheel_get_current_state(Eigen::Vector3f position)
+timestamp Simulator::reaction_wheel_update_desired_state(uint32_t handle, actuator_state new_target)
 {
-    this->update_simulation();
-    actuator_state ret;
-    // figure out which reaction wheel it is
-    for (sim_reaction_wheel wheel : system_vals.reaction_wheels) {
-        if (wheel.position.isApprox(position)) {
-            // Do some math to convert body-frame values to reaction_wheel_frame
-            // ret.position     = wheel.position; // this isn't used anyway
-            ret.acceleration = wheel.alpha;
-            ret.velocity     = wheel.omega;
-            ret.time         = this->simulation_time;
-        }
+    // the motor is commanded to the new acceleration, within what it can drive. A motor with no
+    // time constant drives the command immediately, otherwise the drive follows it in the dynamics
+    sim_wheel_bank &wheels = system_vals.reaction_wheels;
+    wheels.command(handle) = std::max(-wheels.max_alpha(handle), std::min(new_target.acceleration, wheels.max_alpha(handle)));
+    if (0 == wheels.time_constant(handle))
+    {
+        wheels.drive(handle) = wheels.command(handle);
     }
+    this->dynamics.set_wheel_command(handle, wheels.command(handle));
+
+    this->charge_controller_call(ControllerCall::ReactionWheelCommand);
+    return this->simulation_time;
+}
+
+actuator_state Simulator::reaction_wheel_get_current_state(uint32_t handle)
+{
+    this->update_simulation(ControllerCall::ReactionWheelState);
+    actuator_state ret;
+
+    // Do some math to convert body-frame values to reaction_wheel_frame
+    const sim_wheel_bank &wheels = system_vals.reaction_wheels;
+    ret.position     = 0; // this isn't used anyway
+    ret.acceleration = wheels.alpha(handle);
+    ret.velocity     = wheels.omega(handle);
+    ret.time         = this->simulation_time;
 
     return ret;
 }
 
 gyro_state Simulator::gyroscope_take_measurement()
 {
-    this->update_simulation();
+    this->update_simulation(ControllerCall::GyroscopeMeasurement);
     gyro_state ret;
 
     ret.acceleration = this->system_vals.gyroscope.alpha;
-    ret.velocity     = this->system_vals.gyroscope.omega;
-    ret.position     = this->system_vals.gyroscope.theta;
+    ret.velocity     = this->gyroscope_noise.sample(this->system_vals.gyroscope.omega, this->simulation_time);
+    ret.position     = this->gyroscope_noise.sample_attitude(this->system_vals.gyroscope.theta);
     ret.time_taken   = this->simulation_time;
 
     return ret;
@@ -194,8 +615,60 @@ gyro_state Simulator::gyroscope_take_measurement()
 
 timestamp Simulator::accelerometer_take_measurement(Eigen::Vector3f *measurement)
 {
-    this->update_simulation();
-    *measurement = this->system_vals.accelerometer.measurement;
+    this->update_simulation(ControllerCall::AccelerometerMeasurement);
+    *measurement = this->accelerometer_noise.sample(this->system_vals.accelerometer.measurement, this->simulation_time);
+
+    return this->simulation_time;
+}
+
+timestamp Simulator::magnetometer_take_measurement(Eigen::Vector3f *measurement)
+{
+    this->update_simulation(ControllerCall::MagnetometerMeasurement);
+
+    sim_magnetometer &magnetometer = this->system_vals.magnetometer;
+    magnetometer.measurement = Eigen::Vector3f::Zero();
+    if (nullptr != this->orbit_model)
+    {
+        const sim_orbit &orbit = this->system_vals.orbit;
+        const Eigen::Vector3f field = this->magnetic_field.field(orbit.position, orbit.julian_date).cast<float>();
+        magnetometer.measurement = this->system_vals.satellite.attitude_b.conjugate() * field;
+    }
+    *measurement = this->magnetometer_noise.sample(magnetometer.measurement, this->simulation_time);
+
+    return this->simulation_time;
+}
+
+uint32_t Simulator::get_sun_sensor_handle(const std::string &name)
+{
+    for (uint32_t i = 0; i < system_vals.sun_sensors.size(); i++) {
+        if (system_vals.sun_sensors[i].name == name) {
+            return i;
+        }
+    }
+
+    throw invalid_adcs_param("No simulated sun sensor with the name of the sensor.");
+}
+
+timestamp Simulator::sun_sensor_take_measurement(uint32_t handle, Eigen::Vector4f *voltage)
+{
+    this->update_simulation(ControllerCall::SunSensorMeasurement);
+
+    sim_sun_sensor &sun_sensor = this->system_vals.sun_sensors[handle];
+    Eigen::Vector3f sun = Eigen::Vector3f::Zero();
+    if (nullptr != this->orbit_model)
+    {
+        const sim_orbit &orbit = this->system_vals.orbit;
+        const Eigen::Vector3d sun_position = Environment::sun_position(orbit.julian_date);
+        if (!Environment::in_shadow(orbit.position, sun_position))
+        {
+            const Eigen::Vector3f direction = (sun_position - orbit.position).normalized().cast<float>();
+            sun = this->sun_sensor_noise[handle].sample(this->system_vals.satellite.attitude_b.conjugate() * direction,
+                                                        this->simulation_time);
+        }
+    }
+
+    sun_sensor.voltage = SunSensorModel::voltages(sun, sun_sensor.axis, sun_sensor.perpendicular, sun_sensor.max_voltage);
+    *voltage = sun_sensor.voltage;
 
     return this->simulation_time;
 }
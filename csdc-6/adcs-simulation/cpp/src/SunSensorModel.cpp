@@ -0,0 +1,123 @@
+/**
+ * @file    SunSensorModel.cpp
+ *
+ * @details implements the model of the sun sensor diodes as defined in SunSensorModel.hpp.
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <array>
+#include <cmath>
+
+#include "SunSensorModel.hpp"
+
+namespace
+{
+    using namespace sun_sensor_calibration;
+
+    typedef std::array<std::array<float, SunSensorModel::table_size>, num_diodes> response_table;
+
+    constexpr float wrap_degrees(float angle)
+    {
+        while (angle > 180.0f)
+        {
+            angle -= 360.0f;
+        }
+        while (angle <= -180.0f)
+        {
+            angle += 360.0f;
+        }
+        return angle;
+    }
+
+    constexpr float magnitude(float value)
+    {
+        return (value < 0) ? -value : value;
+    }
+
+    /* voltage of one side of a diode at an angle from its peak, where the angles of the side are
+       monotonic from the edge of the calibration to the peak */
+    constexpr float side_voltage(const std::array<float, num_points> &angles, const std::array<float, num_points> &voltages,
+                                 float peak, float angle)
+    {
+        size_t i = 1;
+        while ((i < num_points - 1) &&
+               (magnitude(wrap_degrees(angles[i] - peak)) > magnitude(angle)))
+        {
+            i++;
+        }
+
+        const float start    = wrap_degrees(angles[i - 1] - peak);
+        const float end      = wrap_degrees(angles[i] - peak);
+        const float fraction = (angle - start) / (end - start);
+        return voltages[i - 1] + fraction * (voltages[i] - voltages[i - 1]);
+    }
+
+    constexpr response_table build_response()
+    {
+        response_table table = {};
+        for (size_t diode = 0; diode < num_diodes; diode++)
+        {
+            // the diode faces midway between the two sides at full voltage
+            const float top_end  = angle_top[diode][num_points - 1];
+            const float bot_end  = angle_bot[diode][num_points - 1];
+            const float peak     = wrap_degrees(bot_end + 0.5f * wrap_degrees(top_end - bot_end));
+            const float top_edge = wrap_degrees(angle_top[diode][0] - peak);
+            const float top_peak = wrap_degrees(top_end - peak);
+            const float bot_edge = wrap_degrees(angle_bot[diode][0] - peak);
+            const float bot_peak = wrap_degrees(bot_end - peak);
+
+            for (size_t j = 0; j < SunSensorModel::table_size; j++)
+            {
+                const float angle = wrap_degrees(-180.0f + j * SunSensorModel::resolution - peak);
+
+                float response = 0;
+                if ((angle >= bot_peak) && (angle <= top_peak))
+                {
+                    response = 1;
+                }
+                else if ((angle > top_peak) && (angle <= top_edge))
+                {
+                    response = side_voltage(angle_top[diode], voltage[diode], peak, angle);
+                }
+                else if ((angle < bot_peak) && (angle >= bot_edge))
+                {
+                    response = side_voltage(angle_bot[diode], voltage[diode], peak, angle);
+                }
+                table[diode][j] = response;
+            }
+        }
+        return table;
+    }
+
+    /* fraction of the largest voltage of each diode against the angle of the sun from -180 degrees */
+    constexpr response_table response = build_response();
+}
+
+Eigen::Vector4f SunSensorModel::voltages(const Eigen::Vector3f &sun, const Eigen::Vector3f &axis,
+                                         const Eigen::Vector3f &perpendicular, float max_voltage)
+{
+    const float x = sun.dot(axis);
+    const float y = sun.dot(perpendicular);
+    const float intensity = std::sqrt(x * x + y * y);
+    if (intensity <= 0)
+    {
+        return Eigen::Vector4f::Zero();
+    }
+
+    const float position = (std::atan2(y, x) * static_cast<float>(180 / M_PI) + 180.0f) / resolution;
+    const size_t index   = static_cast<size_t>(position) % table_size;
+    const size_t next    = (index + 1) % table_size;
+    const float fraction = position - std::floor(position);
+
+    Eigen::Vector4f result;
+    for (size_t diode = 0; diode < num_diodes; diode++)
+    {
+        const float level = response[diode][index] + fraction * (response[diode][next] - response[diode][index]);
+        result(diode) = max_voltage * intensity * level;
+    }
+
+    return result;
+}
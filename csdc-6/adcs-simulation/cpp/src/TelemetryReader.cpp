@@ -0,0 +1,146 @@
+/**
+ * @file    TelemetryReader.cpp
+ *
+ * @details implements the TelemetryReader class as defined in TelemetryReader.hpp
+ *
+ * Last Edited
+ * 2026-10-17
+ *
+**/
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "TelemetryReader.hpp"
+
+TelemetryReader::TelemetryReader(const std::string &path)
+{
+    int file = open(path.c_str(), O_RDONLY);
+    if (-1 == file)
+    {
+        throw telemetry_read_failure("Unable to open the telemetry file.");
+    }
+
+    struct stat file_stats;
+    if ( (0 != fstat(file, &file_stats)) ||
+         (sizeof(Telemetry::telemetry_header) > (size_t)file_stats.st_size) )
+    {
+        close(file);
+        throw telemetry_read_failure("Telemetry file is too small to have a header.");
+    }
+
+    this->mapping_size = file_stats.st_size;
+    this->mapping      = mmap(nullptr, this->mapping_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+    /* the mapping stays valid once the file is closed */
+    close(file);
+
+    if (MAP_FAILED == this->mapping)
+    {
+        this->mapping = nullptr;
+        throw telemetry_read_failure("Unable to map the telemetry file.");
+    }
+
+    const char *bytes = static_cast<const char *>(this->mapping);
+    std::memcpy(&this->header, bytes, sizeof(this->header));
+
+    const char *error = nullptr;
+    if (0 != std::memcmp(this->header.magic, Telemetry::magic, sizeof(Telemetry::magic)))
+    {
+        error = "Not a binary telemetry file.";
+    }
+    else if (Telemetry::version != this->header.version)
+    {
+        error = "Unsupported telemetry file version.";
+    }
+    else if (Telemetry::byte_order_mark != this->header.byte_order_mark)
+    {
+        error = "Telemetry file was written with a different byte order.";
+    }
+    else if ( (this->header.header_size > this->mapping_size) ||
+              (0 != (this->header.header_size % Telemetry::header_alignment)) ||
+              (0 == this->header.num_columns) )
+    {
+        error = "Telemetry file header is corrupt.";
+    }
+
+    if (nullptr != error)
+    {
+        munmap(this->mapping, this->mapping_size);
+        throw telemetry_read_failure(error);
+    }
+
+    /* the names are null terminated, and an empty name marks the start of the padding */
+    const char *name     = bytes + sizeof(this->header);
+    const char *name_end = bytes + this->header.header_size;
+    while ( (this->column_names.size() < this->header.num_columns) &&
+            (name < name_end) && ('\0' != *name) )
+    {
+        size_t length = strnlen(name, name_end - name);
+        this->column_names.emplace_back(name, length);
+        name += length + 1;
+    }
+
+    if (this->column_names.size() != this->header.num_columns)
+    {
+        munmap(this->mapping, this->mapping_size);
+        throw telemetry_read_failure("Telemetry file column names are corrupt.");
+    }
+
+    this->records     = reinterpret_cast<const float *>(bytes + this->header.header_size);
+    this->num_records = (this->mapping_size - this->header.header_size) / (sizeof(float) * this->header.num_columns);
+}
+
+TelemetryReader::~TelemetryReader()
+{
+    if (nullptr != this->mapping)
+    {
+        munmap(this->mapping, this->mapping_size);
+    }
+}
+
+uint32_t TelemetryReader::get_column_index(const std::string &name) const
+{
+    for (uint32_t i = 0; i < this->column_names.size(); i++)
+    {
+        if (name == this->column_names.at(i))
+        {
+            return i;
+        }
+    }
+
+    throw telemetry_read_failure("Telemetry file has no column with that name.");
+}
+
+TelemetryReader::column_view TelemetryReader::column(uint32_t index) const
+{
+    if (index >= this->header.num_columns)
+    {
+        throw telemetry_read_failure("Telemetry column index out of range.");
+    }
+
+    return column_view(this->records + index, this->num_records, Eigen::InnerStride<>(this->header.num_columns));
+}
+
+TelemetryReader::column_view TelemetryReader::column(const std::string &name) const
+{
+    return this->column(this->get_column_index(name));
+}
+
+TelemetryReader::record_view TelemetryReader::record(uint64_t index) const
+{
+    if (index >= this->num_records)
+    {
+        throw telemetry_read_failure("Telemetry record index out of range.");
+    }
+
+    return record_view(this->records + index * this->header.num_columns, this->header.num_columns);
+}
+
+TelemetryReader::table_view TelemetryReader::table() const
+{
+    return table_view(this->records, this->num_records, this->header.num_columns);
+}